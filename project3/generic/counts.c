@@ -8,13 +8,16 @@
  *
  *              The program takes one file as a command line argument and
  *              counts the number of times each word appears in the file.
+ *              The set is generated from tset.h for entries, so each entry
+ *              is stored in the table itself and updated in place, and the
+ *              hash and comparison of words are inlined.
  */
 
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
 # include <assert.h>
-# include "set.h"
+# include "tset.h"
 
 struct entry {
     char *word;
@@ -45,28 +48,9 @@ static unsigned strhash(char *s)
 }
 
 
-/*
- * Function:	hashEntry
- *
- * Description:	Return a hash value for an entry based on its word.
- */
-
-static unsigned hashEntry(struct entry *ep)
-{
-    return strhash(ep->word);
-}
-
+/* A set of entries, hashed and compared by their words. */
 
-/*
- * Function:	compareEntries
- *
- * Description:	Compare two entries as in strcmp().
- */
-
-static int compareEntries(struct entry *ep1, struct entry *ep2)
-{
-    return strcmp(ep1->word, ep2->word);
-}
+DEFINE_SET(Counts, struct entry, strhash(k.word), strcmp(a.word, b.word) == 0)
 
 
 /*
@@ -79,8 +63,8 @@ int main(int argc, char *argv[])
 {
     FILE *fp;
     char buffer[BUFSIZ];
-    struct entry e, *ep, **entries;
-    SET *counts;
+    struct entry e, *ep, *entries;
+    Counts *counts;
     int i;
 
 
@@ -99,21 +83,18 @@ int main(int argc, char *argv[])
 
     /* Increment the count on each word read. */
 
-    counts = createSet(MAX_SIZE, compareEntries, hashEntry);
+    counts = createCounts(MAX_SIZE, NULL);
 
     while (fscanf(fp, "%s", buffer) == 1) {
 	e.word = buffer;
-	ep = findElement(counts, &e);
+	ep = findCounts(counts, e);
 
 	if (ep == NULL) {
-	    ep = malloc(sizeof(struct entry));
-	    assert(ep != NULL);
-
-	    ep->word = strdup(buffer);
-	    assert(ep->word != NULL);
+	    e.word = strdup(buffer);
+	    assert(e.word != NULL);
 
-	    ep->count = 1;
-	    addElement(counts, ep);
+	    e.count = 1;
+	    addCounts(counts, e);
 
 	} else
 	    ep->count ++;
@@ -122,16 +103,15 @@ int main(int argc, char *argv[])
 
     /* Print out the counts for each word. */
 
-    entries = getElements(counts);
+    entries = elementsCounts(counts);
 
-    for (i = 0; i < numElements(counts); i ++) {
-	printf("%s: %d\n", entries[i]->word, entries[i]->count);
-	free(entries[i]->word);
-	free(entries[i]);
+    for (i = 0; i < numCounts(counts); i ++) {
+	printf("%s: %d\n", entries[i].word, entries[i].count);
+	free(entries[i].word);
     }
 
     free(entries);
 
-    destroySet(counts);
+    destroyCounts(counts);
     exit(EXIT_SUCCESS);
 }
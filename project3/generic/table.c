@@ -7,9 +7,9 @@
  * 
  * Description: This file defines functions that modify an set of unknown types in a hash table in a variety of 
  *              ways defined by unique.c and parity.c. It contains a struct, createSet,
- *              destroySet, numElements, search, addElement, removeElement, findElement, and getElement.
- *              Note: Decided to use an int flag called copy instead of a boolean flag for determining if
- *              an element is already in this list, hence why it is missing.
+ *              destroySet, numElements, addElement, removeElement, findElement, and getElement.
+ *              The hash table itself is generated from tset.h for pointer elements, and reaches the hash and
+ *              compare functions of the set through its aux pointer, so these functions only pass along to it.
  */
 
 #include <stdio.h>
@@ -17,18 +17,17 @@
 #include <assert.h>
 #include <string.h>
 #include "set.h"
+#include "tset.h"
 
 struct set
 {
-    void** elts;
-    int length;
-    int count;
-    int copy;
-    char *flags;
+    struct Table *table;
     int (*compare)();
     unsigned (*hash)();
 };
 
+DEFINE_SET(Table, void *, (*((SET *) aux) -> hash)(k), (*((SET *) aux) -> compare)(b, a) == 0)
+
 /*
  * Function:    createSet
  * 
@@ -39,22 +38,11 @@ struct set
 
 SET *createSet(int n, int (*compare)(), unsigned (*hash)())
 {
-    int i;
     SET *sp = malloc(sizeof(SET));
     assert(sp);
     sp -> compare = compare;
     sp -> hash = hash;
-    sp -> elts = malloc(sizeof(void*) * n);
-    assert(sp -> elts);
-    sp -> length = n;
-    sp -> count = 0;
-    sp -> copy = 0;
-    sp -> flags = malloc(sizeof(char) * n);
-    assert(sp -> flags);
-    for (i = 0; i < n; i++)
-    {
-        sp -> flags[i] = 'E';
-    }
+    sp -> table = createTable(n, sp);
 
     return sp;
 }
@@ -62,25 +50,24 @@ SET *createSet(int n, int (*compare)(), unsigned (*hash)())
 /*
  * Function:    destroySet
  *
- * Complexity:  O(1)
+ * Complexity:  O(n)
  *
- * Description: Destroys a given set via freeing the pointer.
+ * Description: Destroys a given set via freeing the pointer, along with the elements still in it.
  */
 
 void destroySet(SET* sp)
 {
     assert(sp != NULL);
-	int i;
-	for(i = 0; i < sp->count; i++)
-	{
-    	if(sp->flags[i] == 'F')
+    int i;
+    for (i = 0; i < sp -> table -> length; i++)
+    {
+        if (sp -> table -> flags[i] == TSET_FILLED)
         {
-            free(sp->elts[i]);
+            free(sp -> table -> data[i]);
         }
-	}
-    
-    free(sp->elts);
-    free(sp->flags);
+    }
+
+    destroyTable(sp -> table);
     free(sp);
     return;
 }
@@ -96,55 +83,7 @@ void destroySet(SET* sp)
 int numElements(SET* sp)
 {
     assert(sp != NULL);
-    return sp -> count;
-}
-
-/*
- * Function:    search
- *
- * Complexity:  O(n)
- *
- * Description: Search function used by other functions in this file. 
- *              Searches the hash table, returning the location and
- *              copy flag.
- */
-
-static int search(SET *sp, void *elt)
-{
-    assert(sp != NULL && elt != NULL);
-    int i, index;
-    int first = -1;
-    sp -> copy = 0;
-    unsigned key = (*sp -> hash)(elt);
-
-    for(i = 0; i < sp -> length; i++)
-    {
-        index = (key + i) % sp->length;
-       	if(sp -> flags[index] == 'F')
-        {
-            	if ((*sp -> compare)(elt, sp->elts[index]) == 0)
-            	{
-                	sp -> copy = 1;
-                	return index;
-            	}
-        }
-
-        if(sp->flags[index] == 'D')
-        {
-            first = index;
-        }
-
-        if(sp->flags[index] == 'E')
-        {
-            if(first > -1)
-            {
-            	return first;
-            }
-            return index;
-        }
-    }
-
-    return -1;
+    return numTable(sp -> table);
 }
 
 /*
@@ -158,14 +97,7 @@ static int search(SET *sp, void *elt)
 void addElement(SET *sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int index = search(sp, elt);
-    if (sp -> copy == 0)
-    {
-        assert(sp -> count < sp-> length);
-        sp -> elts[index] = elt;
-        sp -> flags[index] = 'F';
-        sp -> count++;
-    }
+    addTable(sp -> table, elt);
 
     return;
 }
@@ -181,15 +113,7 @@ void addElement(SET *sp, void *elt)
 void removeElement(SET* sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int index = search(sp, elt);
-
-    if (sp -> copy == 0)
-    {
-        return;
-    }
-    
-    sp -> flags[index] = 'D';
-    sp -> count--;
+    removeTable(sp -> table, elt);
 
     return;
 }
@@ -205,14 +129,9 @@ void removeElement(SET* sp, void *elt)
 void *findElement(SET *sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int index = search(sp, elt);
+    void **slot = findTable(sp -> table, elt);
 
-    if (sp -> copy == 0)
-    {
-        return NULL;
-    }
-
-    return sp -> elts[index];
+    return slot != NULL ? *slot : NULL;
 }
 
 /*
@@ -226,18 +145,6 @@ void *findElement(SET *sp, void *elt)
 void *getElements(SET* sp)
 {
     assert(sp != NULL);
-    int i, j = 0;
-    void **arr = malloc(sizeof(void*) * sp -> count);
-    assert(arr);
-    for (i = 0; i < sp -> length; i++, j++)
-    {
-        if (sp -> flags[i] != 'F')
-        {
-            j--;
-            continue;
-        }
-        arr[j] = sp -> elts[i];
-    }
 
-    return arr;
+    return elementsTable(sp -> table);
 }
@@ -0,0 +1,188 @@
+/*
+ * File:	tset.h
+ *
+ * Description:	This file contains a macro that generates a set for one
+ *		type of element.  The elements are stored in the hash
+ *		table itself rather than through pointers, and the hash
+ *		function and the test for equality are expressions given
+ *		to the macro rather than functions called through
+ *		pointers, so the compiler can inline them.  For example,
+ *
+ *		    DEFINE_SET(WordSet, char *, strhash(k),
+ *			strcmp(a, b) == 0)
+ *
+ *		defines the type WordSet and the functions createWordSet,
+ *		destroyWordSet, numWordSet, addWordSet, removeWordSet,
+ *		findWordSet, and elementsWordSet.  The hash expression
+ *		uses an element named k, and the equality expression two
+ *		elements named a and b.  Both may also use aux, a pointer
+ *		given when the set is created, for any other state they
+ *		need.
+ *
+ *		As in table.c, the set has a fixed capacity and uses
+ *		linear probing, with deleted slots reused by later adds.
+ *		Adding and finding return a pointer to the element in the
+ *		table, so an element that is a structure can be updated
+ *		in place.  The pointer is good until the next add or
+ *		remove.
+ */
+
+# ifndef TSET_H
+# define TSET_H
+
+# include <stdlib.h>
+# include <assert.h>
+
+# define TSET_EMPTY   0
+# define TSET_FILLED  1
+# define TSET_DELETED 2
+
+# define DEFINE_SET(name, key_t, hash_expr, eq_expr)			      \
+									      \
+typedef struct name {							      \
+    int count;				/* number of elements in array */     \
+    int length;				/* length of allocated array   */     \
+    key_t *data;			/* array of elements           */     \
+    char *flags;			/* state of each slot in array */     \
+    void *aux;				/* state for the expressions   */     \
+} name;									      \
+									      \
+static inline unsigned hash##name(void *aux, key_t k)			      \
+{									      \
+    return (hash_expr);							      \
+}									      \
+									      \
+static inline int equal##name(void *aux, key_t a, key_t b)		      \
+{									      \
+    return (eq_expr);							      \
+}									      \
+									      \
+static inline int search##name(name *sp, key_t k, int *found)		      \
+{									      \
+    int available, i, locn;						      \
+									      \
+									      \
+    available = -1;							      \
+    locn = hash##name(sp->aux, k) % sp->length;				      \
+									      \
+    for (i = 0; i < sp->length; i ++) {					      \
+	if (sp->flags[locn] == TSET_EMPTY) {				      \
+	    *found = 0;							      \
+	    return available != -1 ? available : locn;			      \
+									      \
+	} else if (sp->flags[locn] == TSET_DELETED) {			      \
+	    if (available == -1)					      \
+		available = locn;					      \
+									      \
+	} else if (equal##name(sp->aux, sp->data[locn], k)) {		      \
+	    *found = 1;							      \
+	    return locn;						      \
+	}								      \
+									      \
+	if (++ locn == sp->length)					      \
+	    locn = 0;							      \
+    }									      \
+									      \
+    *found = 0;								      \
+    return available;							      \
+}									      \
+									      \
+static inline name *create##name(int maxElts, void *aux)		      \
+{									      \
+    name *sp;								      \
+									      \
+									      \
+    assert(maxElts > 0);						      \
+									      \
+    sp = malloc(sizeof(name));						      \
+    assert(sp != NULL);							      \
+									      \
+    sp->data = malloc(sizeof(key_t) * maxElts);				      \
+    assert(sp->data != NULL);						      \
+									      \
+    sp->flags = calloc(maxElts, sizeof(char));				      \
+    assert(sp->flags != NULL);						      \
+									      \
+    sp->length = maxElts;						      \
+    sp->count = 0;							      \
+    sp->aux = aux;							      \
+    return sp;								      \
+}									      \
+									      \
+static inline void destroy##name(name *sp)				      \
+{									      \
+    assert(sp != NULL);							      \
+									      \
+    free(sp->flags);							      \
+    free(sp->data);							      \
+    free(sp);								      \
+}									      \
+									      \
+static inline int num##name(name *sp)					      \
+{									      \
+    assert(sp != NULL);							      \
+    return sp->count;							      \
+}									      \
+									      \
+static inline key_t *add##name(name *sp, key_t k)			      \
+{									      \
+    int locn, found;							      \
+									      \
+									      \
+    assert(sp != NULL);							      \
+    locn = search##name(sp, k, &found);					      \
+									      \
+    if (!found) {							      \
+	assert(sp->count < sp->length);					      \
+									      \
+	sp->data[locn] = k;						      \
+	sp->flags[locn] = TSET_FILLED;					      \
+	sp->count ++;							      \
+    }									      \
+									      \
+    return &sp->data[locn];						      \
+}									      \
+									      \
+static inline void remove##name(name *sp, key_t k)			      \
+{									      \
+    int locn, found;							      \
+									      \
+									      \
+    assert(sp != NULL);							      \
+    locn = search##name(sp, k, &found);					      \
+									      \
+    if (found) {							      \
+	sp->flags[locn] = TSET_DELETED;					      \
+	sp->count --;							      \
+    }									      \
+}									      \
+									      \
+static inline key_t *find##name(name *sp, key_t k)			      \
+{									      \
+    int locn, found;							      \
+									      \
+									      \
+    assert(sp != NULL);							      \
+    locn = search##name(sp, k, &found);					      \
+    return found ? &sp->data[locn] : NULL;				      \
+}									      \
+									      \
+static inline key_t *elements##name(name *sp)				      \
+{									      \
+    int i, j;								      \
+    key_t *elts;							      \
+									      \
+									      \
+    assert(sp != NULL);							      \
+									      \
+    elts = malloc(sizeof(key_t) * (sp->count > 0 ? sp->count : 1));	      \
+    assert(elts != NULL);						      \
+									      \
+    for (i = 0, j = 0; i < sp->length; i ++)				      \
+	if (sp->flags[i] == TSET_FILLED)				      \
+	    elts[j ++] = sp->data[i];					      \
+									      \
+    return elts;							      \
+}
+
+# endif /* TSET_H */
@@ -0,0 +1,605 @@
+/*
+ * File Name: cuckoo.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines the same set of strings as table.c, but stores it in a bucketized cuckoo
+ *              hash table instead of using linear probing. Every element lives in one of two buckets chosen
+ *              by two hash functions, and each bucket holds four elements and fills exactly one cache line,
+ *              so a lookup never reads more than two cache lines of the table. When an insert cannot find a
+ *              free slot it kicks elements out to their other bucket, and if that runs into a cycle the
+ *              table is rebuilt with a new seed or twice as many buckets. A set can be saved to a snapshot
+ *              file that keeps the seed and the slot of every element, so loading it puts each element back
+ *              where it was without rehashing the table.
+ *              It contains three structs, createSet, destroySet, numElements, hashString, altHash, locate,
+ *              place, rebuild, addElement, removeElement, findElement, getElements, saveSet, and loadSet.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "set.h"
+
+#define SLOTS 4         //* elements per bucket
+#define MAX_KICKS 500   //* evictions to try before rebuilding the table
+#define LOAD 85         //* percent of the slots createSet fills at its maximum size
+#define MAGIC "CUCKSNP1"
+#define EMPTY 0xFFFFFFFFu   //* offset stored for an empty slot in a snapshot
+
+typedef struct bucket
+{
+    unsigned hashes[SLOTS]; //* full hash of each element, checked before calling strcmp
+    char *elts[SLOTS];      //* elements, NULL if the slot is empty
+    char pad[64 - SLOTS * (sizeof(unsigned) + sizeof(char*))];
+}BUCKET;
+
+struct set
+{
+    BUCKET *buckets;
+    unsigned mask;  //* number of buckets minus one, the number of buckets is a power of two
+    int count;
+    unsigned seed;  //* seed of the hash functions, changed whenever the table is rebuilt
+    unsigned rng;   //* state for choosing which element to kick out
+};
+
+/*
+ * Snapshot layout: a header, then the offset of the element in every slot of every bucket in the
+ * string heap, or EMPTY, then the string heap itself.
+ */
+
+struct header
+{
+    char magic[8];
+    unsigned length;    //* number of buckets
+    unsigned count;
+    unsigned seed;
+    unsigned heapsize;
+};
+
+/*
+ * Function:    createTable
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Allocates an empty, cache line aligned array of buckets.
+ */
+
+static BUCKET *createTable(unsigned n)
+{
+    BUCKET *buckets = aligned_alloc(64, sizeof(BUCKET) * n);
+    assert(buckets != NULL);
+    memset(buckets, 0, sizeof(BUCKET) * n);
+
+    return buckets;
+}
+
+/*
+ * Function:    createSet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Creates a set that returns a set pointer and takes a max number of elements.
+ *              The set still grows if more elements are added.
+ */
+
+SET *createSet(int n)
+{
+    unsigned length = 1;
+    SET *sp = malloc(sizeof(SET));
+    assert(sp);
+
+    while (length * SLOTS * LOAD / 100 < n)
+    {
+        length *= 2;
+    }
+
+    sp -> buckets = createTable(length);
+    sp -> mask = length - 1;
+    sp -> count = 0;
+    sp -> seed = 0;
+    sp -> rng = 2463534242u;
+
+    return sp;
+}
+
+/*
+ * Function:    destroySet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Destroys a given set via freeing the pointer.
+ */
+
+void destroySet(SET *sp)
+{
+    assert(sp != NULL);
+    unsigned i;
+    int j;
+
+    for (i = 0; i <= sp -> mask; i++)
+    {
+        for (j = 0; j < SLOTS; j++)
+        {
+            free(sp -> buckets[i].elts[j]);
+        }
+    }
+
+    free(sp -> buckets);
+    free(sp);
+    return;
+}
+
+/*
+ * Function:    numElements
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns the number of elements in a given set.
+ */
+
+int numElements(SET *sp)
+{
+    assert(sp != NULL);
+    return sp -> count;
+}
+
+/*
+ * Function:    hashString
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Seeded FNV-1a hash. Unlike the hash in table.c, strings that collide under one seed
+ *              usually do not collide under the next, so rebuilding with a new seed breaks up cycles.
+ */
+
+static unsigned hashString(char *str, unsigned seed)
+{
+    unsigned hash = 2166136261u ^ seed;
+
+    while (*str != '\0')
+    {
+        hash = (hash ^ (unsigned char) *str++) * 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+ * Function:    altHash
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Mixes the hash of an element into the index of its second bucket.
+ */
+
+static unsigned altHash(unsigned hash)
+{
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    hash = (hash ^ (hash >> 16)) * 0x45d9f3bu;
+    return hash ^ (hash >> 16);
+}
+
+/*
+ * Function:    locate
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Searches both buckets of an element. Returns its bucket and stores its slot in *slot,
+ *              or returns NULL if it is not in the set.
+ */
+
+static BUCKET *locate(SET *sp, char *elt, unsigned hash, int *slot)
+{
+    int i;
+    BUCKET *b1 = &sp -> buckets[hash & sp -> mask];
+    BUCKET *b2 = &sp -> buckets[altHash(hash) & sp -> mask];
+
+    for (i = 0; i < SLOTS; i++)
+    {
+        if (b1 -> elts[i] != NULL && b1 -> hashes[i] == hash && strcmp(b1 -> elts[i], elt) == 0)
+        {
+            *slot = i;
+            return b1;
+        }
+    }
+
+    for (i = 0; i < SLOTS; i++)
+    {
+        if (b2 -> elts[i] != NULL && b2 -> hashes[i] == hash && strcmp(b2 -> elts[i], elt) == 0)
+        {
+            *slot = i;
+            return b2;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Function:    place
+ *
+ * Complexity:  O(1) amortized
+ *
+ * Description: Stores an element that is not yet in the table, kicking other elements to their other
+ *              bucket as needed. Returns NULL on success, or the element left without a slot if the
+ *              kicks ran into a cycle.
+ */
+
+static char *place(SET *sp, char *elt, unsigned hash)
+{
+    int i, k, victim;
+    unsigned index = hash & sp -> mask;
+    char *tempElt;
+    unsigned tempHash;
+
+    for (i = 0; i < SLOTS; i++)
+    {
+        if (sp -> buckets[index].elts[i] == NULL)
+        {
+            sp -> buckets[index].elts[i] = elt;
+            sp -> buckets[index].hashes[i] = hash;
+            return NULL;
+        }
+    }
+
+    index = altHash(hash) & sp -> mask;
+
+    for (k = 0; k < MAX_KICKS; k++)
+    {
+        for (i = 0; i < SLOTS; i++)
+        {
+            if (sp -> buckets[index].elts[i] == NULL)
+            {
+                sp -> buckets[index].elts[i] = elt;
+                sp -> buckets[index].hashes[i] = hash;
+                return NULL;
+            }
+        }
+
+        //* the bucket is full, so swap with a random element of it and move that one to its other bucket
+        sp -> rng ^= sp -> rng << 13;
+        sp -> rng ^= sp -> rng >> 17;
+        sp -> rng ^= sp -> rng << 5;
+        victim = sp -> rng % SLOTS;
+
+        tempElt = sp -> buckets[index].elts[victim];
+        tempHash = sp -> buckets[index].hashes[victim];
+        sp -> buckets[index].elts[victim] = elt;
+        sp -> buckets[index].hashes[victim] = hash;
+        elt = tempElt;
+        hash = tempHash;
+
+        index = (hash & sp -> mask) == index ? altHash(hash) & sp -> mask : hash & sp -> mask;
+    }
+
+    return elt;
+}
+
+/*
+ * Function:    rebuild
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Rehashes every element plus one pending element with a new seed. The table is doubled
+ *              if it is at least half full or if a rebuild at the current size still runs into a cycle.
+ */
+
+static void rebuild(SET *sp, char *pending)
+{
+    unsigned i, length = sp -> mask + 1;
+    int j, k = 0, n = sp -> count + 1;
+    char *left;
+    char **elts = malloc(sizeof(char*) * n);
+    assert(elts != NULL);
+
+    for (i = 0; i < length; i++)
+    {
+        for (j = 0; j < SLOTS; j++)
+        {
+            if (sp -> buckets[i].elts[j] != NULL)
+            {
+                elts[k++] = sp -> buckets[i].elts[j];
+            }
+        }
+    }
+    elts[k] = pending;
+
+    if (n * 2 > length * SLOTS)
+    {
+        length *= 2;
+    }
+
+    while (1)
+    {
+        free(sp -> buckets);
+        sp -> buckets = createTable(length);
+        sp -> mask = length - 1;
+        sp -> seed++;
+
+        for (k = 0, left = NULL; k < n && left == NULL; k++)
+        {
+            left = place(sp, elts[k], hashString(elts[k], sp -> seed));
+        }
+
+        if (left == NULL)
+        {
+            break;
+        }
+
+        length *= 2;
+    }
+
+    free(elts);
+    return;
+}
+
+/*
+ * Function:    addElement
+ *
+ * Complexity:  O(1) amortized
+ *
+ * Description: Adds a given element to a given set and places it in one of its two buckets.
+ */
+
+void addElement(SET *sp, char *str)
+{
+    assert(sp != NULL && str != NULL);
+    int slot;
+    unsigned hash = hashString(str, sp -> seed);
+
+    if (locate(sp, str, hash, &slot) == NULL)
+    {
+        char *temp = strdup(str);
+        assert(temp != NULL);
+        char *left = place(sp, temp, hash);
+        if (left != NULL)
+        {
+            rebuild(sp, left);
+        }
+        sp -> count++;
+    }
+
+    return;
+}
+
+/*
+ * Function:    removeElement
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Removes a given element from a given set and empties its slot.
+ */
+
+void removeElement(SET *sp, char *str)
+{
+    assert(sp != NULL && str != NULL);
+    int slot;
+    BUCKET *bp = locate(sp, str, hashString(str, sp -> seed), &slot);
+
+    if (bp == NULL)
+    {
+        return;
+    }
+
+    free(bp -> elts[slot]);
+    bp -> elts[slot] = NULL;
+    sp -> count--;
+
+    return;
+}
+
+/*
+ * Function:	findElement
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Finds a given element in a given set. Returns NULL if it was not found.
+ */
+
+char *findElement(SET *sp, char *str)
+{
+    assert(sp != NULL && str != NULL);
+    int slot;
+    BUCKET *bp = locate(sp, str, hashString(str, sp -> seed), &slot);
+
+    if (bp == NULL)
+    {
+        return NULL;
+    }
+
+    return bp -> elts[slot];
+}
+
+/*
+ * Function:	getElements
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Allocates an array of elements in a set and returns it.
+*/
+
+char **getElements(SET *sp)
+{
+    assert(sp != NULL);
+    unsigned i;
+    int j, k = 0;
+    char **arr = malloc(sizeof(char*) * sp -> count);
+    assert(arr);
+
+    for (i = 0; i <= sp -> mask; i++)
+    {
+        for (j = 0; j < SLOTS; j++)
+        {
+            if (sp -> buckets[i].elts[j] != NULL)
+            {
+                arr[k++] = sp -> buckets[i].elts[j];
+            }
+        }
+    }
+
+    return arr;
+}
+
+/*
+ * Function:	saveSet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Writes a given set to a snapshot file that loadSet can read back in. Returns 1 on success
+ *              and 0 if the file could not be written.
+*/
+
+int saveSet(SET *sp, char *path)
+{
+    assert(sp != NULL && path != NULL);
+    unsigned i, length = sp -> mask + 1, offset = 0;
+    int j, ok;
+    struct header hdr;
+    FILE *fp = fopen(path, "wb");
+
+    if (fp == NULL)
+    {
+        return 0;
+    }
+
+    unsigned *offsets = malloc(sizeof(unsigned) * length * SLOTS);
+    assert(offsets);
+    for (i = 0; i < length; i++)
+    {
+        for (j = 0; j < SLOTS; j++)
+        {
+            offsets[i * SLOTS + j] = EMPTY;
+            if (sp -> buckets[i].elts[j] != NULL)
+            {
+                offsets[i * SLOTS + j] = offset;
+                offset += strlen(sp -> buckets[i].elts[j]) + 1;
+            }
+        }
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, MAGIC, sizeof(hdr.magic));
+    hdr.length = length;
+    hdr.count = sp -> count;
+    hdr.seed = sp -> seed;
+    hdr.heapsize = offset;
+
+    ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+    ok = ok && fwrite(offsets, sizeof(unsigned), length * SLOTS, fp) == length * SLOTS;
+    for (i = 0; ok && i < length; i++)
+    {
+        for (j = 0; ok && j < SLOTS; j++)
+        {
+            if (sp -> buckets[i].elts[j] != NULL)
+            {
+                ok = fputs(sp -> buckets[i].elts[j], fp) != EOF && putc('\0', fp) != EOF;
+            }
+        }
+    }
+
+    free(offsets);
+    if (fclose(fp) != 0)
+    {
+        ok = 0;
+    }
+
+    return ok;
+}
+
+/*
+ * Function:	loadSet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Reads a snapshot file written by saveSet and returns a set with every element in the slot it
+ *              was saved in. Returns NULL if the file cannot be read or is not a snapshot, or if an element is
+ *              missing, runs past the string heap, or is in neither of its two buckets.
+*/
+
+SET *loadSet(char *path)
+{
+    assert(path != NULL);
+    struct header hdr;
+    struct stat st;
+    unsigned i, *offsets = NULL, hash, filled = 0;
+    int j, ok;
+    char *heap = NULL, *elt;
+    SET *sp = NULL;
+    FILE *fp = fopen(path, "rb");
+
+    if (fp == NULL)
+    {
+        return NULL;
+    }
+
+    //* the number of buckets is checked against the size of the file before anything is allocated
+    ok = fstat(fileno(fp), &st) == 0 && fread(&hdr, sizeof(hdr), 1, fp) == 1 &&
+         memcmp(hdr.magic, MAGIC, sizeof(hdr.magic)) == 0 && hdr.length > 0 &&
+         (hdr.length & (hdr.length - 1)) == 0 && hdr.count <= (size_t) hdr.length * SLOTS &&
+         st.st_size == sizeof(hdr) + sizeof(unsigned) * SLOTS * (size_t) hdr.length + hdr.heapsize &&
+         (hdr.heapsize == 0) == (hdr.count == 0);
+
+    if (ok)
+    {
+        offsets = malloc(sizeof(unsigned) * SLOTS * (size_t) hdr.length);
+        heap = malloc(hdr.heapsize > 0 ? hdr.heapsize : 1);
+        assert(offsets != NULL && heap != NULL);
+        ok = fread(offsets, sizeof(unsigned), SLOTS * (size_t) hdr.length, fp) == SLOTS * (size_t) hdr.length &&
+             fread(heap, sizeof(char), hdr.heapsize, fp) == hdr.heapsize &&
+             (hdr.heapsize == 0 || heap[hdr.heapsize - 1] == '\0');
+    }
+    fclose(fp);
+
+    if (ok)
+    {
+        sp = malloc(sizeof(SET));
+        assert(sp);
+        sp -> buckets = createTable(hdr.length);
+        sp -> mask = hdr.length - 1;
+        sp -> count = hdr.count;
+        sp -> seed = hdr.seed;
+        sp -> rng = 2463534242u;
+
+        for (i = 0; ok && i < hdr.length; i++)
+        {
+            for (j = 0; ok && j < SLOTS; j++)
+            {
+                if (offsets[i * SLOTS + j] == EMPTY)
+                {
+                    continue;
+                }
+
+                ok = offsets[i * SLOTS + j] < hdr.heapsize;
+                if (ok)
+                {
+                    //* an element in neither of its buckets could never be found again
+                    elt = heap + offsets[i * SLOTS + j];
+                    hash = hashString(elt, hdr.seed);
+                    ok = (hash & sp -> mask) == i || (altHash(hash) & sp -> mask) == i;
+                }
+                if (ok)
+                {
+                    sp -> buckets[i].elts[j] = strdup(elt);
+                    assert(sp -> buckets[i].elts[j] != NULL);
+                    sp -> buckets[i].hashes[j] = hash;
+                    filled++;
+                }
+            }
+        }
+
+        if (!ok || filled != hdr.count)
+        {
+            destroySet(sp);
+            sp = NULL;
+        }
+    }
+
+    free(offsets);
+    free(heap);
+
+    return sp;
+}
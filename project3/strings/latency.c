@@ -0,0 +1,111 @@
+/*
+ * File Name: latency.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Measures how long single lookups take in a set of strings. All words in the first file are
+ *              inserted into the set, then every word in the second file (or the first file again) is looked
+ *              up and timed on its own. The median and tail latencies are printed in nanoseconds, so the
+ *              linear probing table and the cuckoo table can be compared by linking this file against
+ *              table.c or cuckoo.c. It contains compare and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include "set.h"
+
+/* This is sufficient for the test cases in /scratch/coen12. */
+
+#define MAX_SIZE 18000
+
+/*
+ * Function: compare
+ *
+ * Description: compares two latencies for qsort
+ */
+
+static int compare(const void *a, const void *b)
+{
+    long x = *(const long *) a, y = *(const long *) b;
+    return (x < y) ? -1 : (x > y);
+}
+
+/*
+ * Function: main
+ *
+ * Description: driver function. builds the set, times every lookup, and prints the percentiles.
+ */
+
+int main(int argc, char *argv[])
+{
+    FILE *fp;
+    char buffer[BUFSIZ];
+    struct timespec start, stop;
+    long *times;
+    int n = 0, length = 1024, hits = 0;
+    SET *sp;
+
+    if (argc != 2 && argc != 3)
+    {
+        fprintf(stderr, "usage: %s file1 [file2]\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    if ((fp = fopen(argv[1], "r")) == NULL)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+        exit(EXIT_FAILURE);
+    }
+
+    sp = createSet(MAX_SIZE);
+    while (fscanf(fp, "%s", buffer) == 1)
+    {
+        addElement(sp, buffer);
+    }
+    fclose(fp);
+
+    if ((fp = fopen(argv[argc - 1], "r")) == NULL)
+    {
+        fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[argc - 1]);
+        exit(EXIT_FAILURE);
+    }
+
+    times = malloc(sizeof(long) * length);
+    assert(times != NULL);
+
+    while (fscanf(fp, "%s", buffer) == 1)
+    {
+        if (n == length)
+        {
+            length *= 2;
+            times = realloc(times, sizeof(long) * length);
+            assert(times != NULL);
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        hits += findElement(sp, buffer) != NULL;
+        clock_gettime(CLOCK_MONOTONIC, &stop);
+        times[n++] = (stop.tv_sec - start.tv_sec) * 1000000000L + stop.tv_nsec - start.tv_nsec;
+    }
+    fclose(fp);
+
+    if (n == 0)
+    {
+        fprintf(stderr, "%s: no words to look up\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    qsort(times, n, sizeof(long), compare);
+    printf("%d lookups, %d found\n", n, hits);
+    printf("p50 %ld ns, p90 %ld ns, p99 %ld ns, p99.9 %ld ns, max %ld ns\n", times[n / 2],
+           times[(long) n * 90 / 100], times[(long) n * 99 / 100], times[(long) n * 999 / 1000], times[n - 1]);
+
+    free(times);
+    destroySet(sp);
+    exit(EXIT_SUCCESS);
+}
@@ -27,4 +27,8 @@ char *findElement(SET *sp, char *elt);
 
 char **getElements(SET *sp);
 
+int saveSet(SET *sp, char *path);
+
+SET *loadSet(char *path);
+
 # endif /* SET_H */
@@ -7,17 +7,27 @@
  * 
  * Description: This file defines functions that modify an set in a hash table in avariety of 
  *              ways defined by unique.c and parity.c. It contains a struct, createSet,
- *              destroySet, numElements, strhash, search, addElement, removeElement, findElement, and getElement.
+ *              destroySet, numElements, strhash, search, addElement, removeElement, findElement, getElement,
+ *              saveSet, and loadSet.
  *              Note: Decided to use an int flag called copy instead of a boolean flag for determining if
  *              an element is already in this list, hence why it is missing.
+ *              A set can also be saved to a snapshot file and loaded back by mapping the file into memory,
+ *              in which case lookups are served directly out of the mapping until the set is first changed.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "set.h"
 
+#define MAGIC "SETSNAP1"
+
 struct set
 {
     char** elts;
@@ -25,6 +35,25 @@ struct set
     int count;
     int copy;
     char *flags;
+    char *map;          //* mapped snapshot, NULL if the set lives on the heap
+    size_t mapsize;     //* size of the mapped snapshot
+    unsigned *offsets;  //* offset of each element in the string heap of the snapshot
+    char *heap;         //* string heap of the snapshot
+};
+
+/*
+ * Snapshot layout: a header, then the flags of every slot (padded to a multiple of four bytes),
+ * then the offset of every slot in the string heap, then the string heap itself. No pointers
+ * are stored, so the file can be mapped at any address.
+ */
+
+struct header
+{
+    char magic[8];
+    unsigned length;
+    unsigned count;
+    unsigned heapsize;
+    unsigned pad;
 };
 
 /*
@@ -47,6 +76,10 @@ SET *createSet(int n)
     sp -> copy = 0;
     sp -> flags = malloc(sizeof(char) * n);
     assert(sp -> flags);
+    sp -> map = NULL;
+    sp -> mapsize = 0;
+    sp -> offsets = NULL;
+    sp -> heap = NULL;
     for (i = 0; i < n; i++)
     {
         sp -> flags[i] = 'E';
@@ -67,7 +100,15 @@ void destroySet(SET* sp)
 {
     assert(sp != NULL);
 	int i;
-	for(i = 0; i < sp->count; i++)
+
+    if (sp -> map != NULL)
+    {
+        munmap(sp -> map, sp -> mapsize);
+        free(sp);
+        return;
+    }
+
+	for(i = 0; i < sp->length; i++)
 	{
     	if(sp->flags[i] == 'F')
         {
@@ -115,6 +156,62 @@ unsigned strhash(char *str)
     return hash;
 }
 
+/*
+ * Function:    element
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns the element stored at a given index, either from the heap or from the mapped snapshot.
+ */
+
+static char *element(SET *sp, int index)
+{
+    if (sp -> map != NULL)
+    {
+        return sp -> heap + sp -> offsets[index];
+    }
+
+    return sp -> elts[index];
+}
+
+/*
+ * Function:    thaw
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Copies a mapped snapshot onto the heap so the set can be changed. The layout of the
+ *              table is kept, so any index found by search stays valid.
+ */
+
+static void thaw(SET *sp)
+{
+    int i;
+    char **elts = malloc(sizeof(char*) * sp -> length);
+    assert(elts);
+    char *flags = malloc(sizeof(char) * sp -> length);
+    assert(flags);
+
+    for (i = 0; i < sp -> length; i++)
+    {
+        flags[i] = sp -> flags[i];
+        if (flags[i] == 'F')
+        {
+            elts[i] = strdup(element(sp, i));
+            assert(elts[i] != NULL);
+        }
+    }
+
+    munmap(sp -> map, sp -> mapsize);
+    sp -> map = NULL;
+    sp -> mapsize = 0;
+    sp -> offsets = NULL;
+    sp -> heap = NULL;
+    sp -> elts = elts;
+    sp -> flags = flags;
+
+    return;
+}
+
 /*
  * Function:    search
  *
@@ -138,7 +235,7 @@ static int search(SET *sp, char *elt)
         index = (key + i) % sp->length;
        	if(sp -> flags[index] == 'F')
         {
-            	if (strcmp(elt, sp->elts[index]) == 0)
+            	if (strcmp(elt, element(sp, index)) == 0)
             	{
                 	sp -> copy = 1;
                 	return index;
@@ -160,7 +257,7 @@ static int search(SET *sp, char *elt)
         }
     }
 
-    return -1;
+    return first;
 }
 
 /*
@@ -178,6 +275,10 @@ void addElement(SET *sp, char *str)
     if (sp -> copy == 0)
     {
         assert(sp -> count < sp-> length);
+        if (sp -> map != NULL)
+        {
+            thaw(sp);
+        }
         char *temp = strdup(str);
         assert(temp != NULL);
         sp -> elts[index] = temp;
@@ -205,6 +306,11 @@ void removeElement(SET* sp, char *str)
     {
         return;
     }
+
+    if (sp -> map != NULL)
+    {
+        thaw(sp);
+    }
     
     free(sp -> elts[index]);
     sp -> flags[index] = 'D';
@@ -231,7 +337,7 @@ char *findElement(SET *sp, char *str)
         return NULL;
     }
 
-    return sp -> elts[index];
+    return element(sp, index);
 }
 
 /*
@@ -255,8 +361,164 @@ char **getElements(SET* sp)
             j--;
             continue;
         }
-        arr[j] = sp -> elts[i];
+        arr[j] = element(sp, i);
     }
 
     return arr;
+}
+
+/*
+ * Function:	saveSet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Writes a given set to a snapshot file that loadSet can map back in. Returns 1 on success
+ *              and 0 if the file could not be written.
+*/
+
+int saveSet(SET *sp, char *path)
+{
+    assert(sp != NULL && path != NULL);
+    int i, ok;
+    unsigned offset = 0;
+    struct header hdr;
+    char pad[4] = { 0 };
+    FILE *fp = fopen(path, "wb");
+
+    if (fp == NULL)
+    {
+        return 0;
+    }
+
+    unsigned *offsets = malloc(sizeof(unsigned) * sp -> length);
+    assert(offsets);
+    for (i = 0; i < sp -> length; i++)
+    {
+        offsets[i] = offset;
+        if (sp -> flags[i] == 'F')
+        {
+            offset += strlen(element(sp, i)) + 1;
+        }
+    }
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, MAGIC, sizeof(hdr.magic));
+    hdr.length = sp -> length;
+    hdr.count = sp -> count;
+    hdr.heapsize = offset;
+
+    ok = fwrite(&hdr, sizeof(hdr), 1, fp) == 1;
+    ok = ok && fwrite(sp -> flags, sizeof(char), sp -> length, fp) == sp -> length;
+    ok = ok && fwrite(pad, sizeof(char), (4 - sp -> length % 4) % 4, fp) == (4 - sp -> length % 4) % 4;
+    ok = ok && fwrite(offsets, sizeof(unsigned), sp -> length, fp) == sp -> length;
+    for (i = 0; ok && i < sp -> length; i++)
+    {
+        if (sp -> flags[i] == 'F')
+        {
+            ok = fputs(element(sp, i), fp) != EOF && putc('\0', fp) != EOF;
+        }
+    }
+
+    free(offsets);
+    if (fclose(fp) != 0)
+    {
+        ok = 0;
+    }
+
+    return ok;
+}
+
+/*
+ * Function:	loadSet
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Maps a snapshot file written by saveSet and returns a set that reads straight out of it.
+ *              Returns NULL if the file cannot be opened or is not a snapshot, or if its header, flags, or
+ *              offsets do not agree with each other.
+*/
+
+SET *loadSet(char *path)
+{
+    assert(path != NULL);
+    struct header *hdr;
+    struct stat st;
+    size_t flagsize;
+    unsigned i, filled, *offsets;
+    char *map, *flags, *heap;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    if (fstat(fd, &st) < 0 || st.st_size < sizeof(struct header))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    hdr = (struct header *) map;
+    if (memcmp(hdr -> magic, MAGIC, sizeof(hdr -> magic)) != 0 || hdr -> length == 0 ||
+        hdr -> length > INT_MAX || hdr -> count > hdr -> length)
+    {
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    flagsize = ((size_t) hdr -> length + 3) / 4 * 4;
+    if (st.st_size != sizeof(struct header) + flagsize + sizeof(unsigned) * hdr -> length + hdr -> heapsize)
+    {
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    //* every filled slot must point into the heap, and the heap must end in a NUL so no string runs past it
+    flags = map + sizeof(struct header);
+    offsets = (unsigned *) (flags + flagsize);
+    heap = (char *) (offsets + hdr -> length);
+    filled = 0;
+    for (i = 0; i < hdr -> length; i++)
+    {
+        if (flags[i] == 'F')
+        {
+            if (offsets[i] >= hdr -> heapsize)
+            {
+                break;
+            }
+            filled++;
+        }
+        else if (flags[i] != 'E' && flags[i] != 'D')
+        {
+            break;
+        }
+    }
+
+    if (i < hdr -> length || filled != hdr -> count || (hdr -> heapsize > 0 && heap[hdr -> heapsize - 1] != '\0'))
+    {
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    SET *sp = malloc(sizeof(SET));
+    assert(sp);
+    sp -> map = map;
+    sp -> mapsize = st.st_size;
+    sp -> length = hdr -> length;
+    sp -> count = hdr -> count;
+    sp -> copy = 0;
+    sp -> elts = NULL;
+    sp -> flags = flags;
+    sp -> offsets = offsets;
+    sp -> heap = heap;
+
+    return sp;
 }
\ No newline at end of file
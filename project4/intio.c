@@ -0,0 +1,375 @@
+/*
+ * File Name: intio.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines buffered reading and writing of integers in bulk. A READER reads its file
+ *              a megabyte at a time with read, and parses each integer eight characters at a time: the eight
+ *              bytes are loaded as one 64-bit word, a few word operations find where the digits stop, and
+ *              three multiplies turn up to eight digits into their value, so there is no branch per
+ *              character. The reader keeps at least MARGIN bytes ahead of the current position whenever more
+ *              of the file is left, so an integer rarely runs off the end of the block, and one that does, such
+ *              as one with many leading zeros, reads more of the file as its digits are taken. A WRITER
+ *              formats integers two digits at a time from a table of the 100 two-digit pairs into a one
+ *              megabyte buffer, and writes the buffer when it fills. The word tricks assume a little-endian
+ *              machine. These functions include refill, parseEight, createReader, destroyReader, readLong,
+ *              flush, createWriter, destroyWriter, and writeLong.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include <unistd.h>
+#include "intio.h"
+
+#define BLOCK (1 << 20)     //* bytes read or written at a time
+#define MARGIN 32           //* bytes kept ahead of the position, longer than any integer
+
+#define ONES 0x0101010101010101ULL      //* a one in every byte
+#define HIGHS 0x8080808080808080ULL     //* the high bit of every byte
+
+struct reader
+{
+    int fd;             //* file being read
+    char* buf;          //* block of the file
+    size_t pos;         //* next byte to parse
+    size_t end;         //* bytes in the buffer
+    int eof;            //* whether the whole file has been read
+};
+
+struct writer
+{
+    int fd;             //* file being written
+    char* buf;          //* formatted output not yet written
+    size_t pos;         //* bytes in the buffer
+};
+
+static const uint64_t powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+static const char pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*
+ * Function: refill
+ *
+ * Description: moves the unparsed bytes to the front of the buffer and reads the file until the buffer is
+ *              full or the file ends
+ *
+ * Big-O: O(n)
+*/
+
+static void refill(READER *rp)
+{
+    ssize_t size;
+
+    memmove(rp -> buf, rp -> buf + rp -> pos, rp -> end - rp -> pos);
+    rp -> end -= rp -> pos;
+    rp -> pos = 0;
+
+    while (rp -> end < BLOCK && !rp -> eof)
+    {
+        size = read(rp -> fd, rp -> buf + rp -> end, BLOCK - rp -> end);
+        if (size <= 0)
+        {
+            rp -> eof = 1;
+        }
+        else
+        {
+            rp -> end += size;
+        }
+    }
+
+    return;
+}
+
+/*
+ * Function: parseEight
+ *
+ * Description: returns the value of eight decimal digits held one per byte, with the first digit in the
+ *              lowest byte. Each step combines neighbouring groups: pairs of digits, then pairs of pairs, then
+ *              the two halves.
+ *
+ * Big-O: O(1)
+*/
+
+static uint32_t parseEight(uint64_t digits)
+{
+    digits = digits * 10 + (digits >> 8);
+    digits = ((digits & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+              ((digits >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >> 32;
+
+    return (uint32_t) digits;
+}
+
+/*
+ * Function: createReader
+ *
+ * Description: creates a reader for an open file descriptor
+ *
+ * Big-O: O(1)
+*/
+
+READER *createReader(int fd)
+{
+    READER *rp = malloc(sizeof(READER));
+    assert(rp != NULL);
+    rp -> buf = malloc(BLOCK);
+    assert(rp -> buf != NULL);
+    rp -> fd = fd;
+    rp -> pos = 0;
+    rp -> end = 0;
+    rp -> eof = 0;
+
+    return rp;
+}
+
+/*
+ * Function: destroyReader
+ *
+ * Description: destroys a reader, but does not close its file
+ *
+ * Big-O: O(1)
+*/
+
+void destroyReader(READER *rp)
+{
+    assert(rp != NULL);
+    free(rp -> buf);
+    free(rp);
+
+    return;
+}
+
+/*
+ * Function: readLong
+ *
+ * Description: skips white space and reads an integer with an optional sign. Returns 1 if one was read, or 0
+ *              at the end of the file or if the next characters are not an integer, like scanf.
+ *
+ * Big-O: O(1) amortized
+*/
+
+int readLong(READER *rp, long *x)
+{
+    assert(rp != NULL && x != NULL);
+    uint64_t word, digits, mask, value = 0;
+    int length, negative = 0;
+    char c;
+
+    //* skip white space, reading more of the file as needed
+    while (1)
+    {
+        if (rp -> pos == rp -> end)
+        {
+            if (rp -> eof)
+            {
+                return 0;
+            }
+            refill(rp);
+            continue;
+        }
+
+        c = rp -> buf[rp -> pos];
+        if (c != ' ' && c != '\n' && c != '\t' && c != '\r' && c != '\v' && c != '\f')
+        {
+            break;
+        }
+        rp -> pos++;
+    }
+
+    if (rp -> end - rp -> pos < MARGIN && !rp -> eof)
+    {
+        refill(rp);
+    }
+
+    if (rp -> buf[rp -> pos] == '-' || rp -> buf[rp -> pos] == '+')
+    {
+        negative = rp -> buf[rp -> pos++] == '-';
+    }
+
+    if (rp -> pos == rp -> end || rp -> buf[rp -> pos] < '0' || rp -> buf[rp -> pos] > '9')
+    {
+        return 0;
+    }
+
+    //* take up to eight digits at a time, reading more of the file whenever less than a word is left
+    length = 8;
+    while (length == 8)
+    {
+        if (rp -> end - rp -> pos < 8)
+        {
+            if (rp -> eof)
+            {
+                break;
+            }
+            refill(rp);
+            continue;
+        }
+
+        memcpy(&word, rp -> buf + rp -> pos, 8);
+        digits = word - '0' * ONES;
+
+        //* a byte is not a digit if subtracting '0' went below zero or left more than 9
+        mask = (digits | (digits + 0x76 * ONES)) & HIGHS;
+        length = mask ? __builtin_ctzll(mask) / 8 : 8;
+
+        if (length > 0)
+        {
+            //* shift out the bytes after the digits, which leaves zeros in front of them
+            if (length < 8)
+            {
+                digits <<= 8 * (8 - length);
+            }
+            value = value * powers[length] + parseEight(digits);
+            rp -> pos += length;
+        }
+    }
+
+    //* finish one character at a time at the very end of the file
+    if (length == 8)
+    {
+        while (rp -> pos < rp -> end && rp -> buf[rp -> pos] >= '0' && rp -> buf[rp -> pos] <= '9')
+        {
+            value = value * 10 + (rp -> buf[rp -> pos++] - '0');
+        }
+    }
+
+    *x = negative ? -(long) value : (long) value;
+
+    return 1;
+}
+
+/*
+ * Function: flush
+ *
+ * Description: writes out everything in a writer's buffer
+ *
+ * Big-O: O(n)
+*/
+
+static void flush(WRITER *wp)
+{
+    size_t done = 0;
+    ssize_t size;
+
+    while (done < wp -> pos)
+    {
+        size = write(wp -> fd, wp -> buf + done, wp -> pos - done);
+        if (size <= 0)
+        {
+            perror("write");
+            exit(EXIT_FAILURE);
+        }
+        done += size;
+    }
+
+    wp -> pos = 0;
+
+    return;
+}
+
+/*
+ * Function: createWriter
+ *
+ * Description: creates a writer for an open file descriptor
+ *
+ * Big-O: O(1)
+*/
+
+WRITER *createWriter(int fd)
+{
+    WRITER *wp = malloc(sizeof(WRITER));
+    assert(wp != NULL);
+    wp -> buf = malloc(BLOCK);
+    assert(wp -> buf != NULL);
+    wp -> fd = fd;
+    wp -> pos = 0;
+
+    return wp;
+}
+
+/*
+ * Function: destroyWriter
+ *
+ * Description: writes out anything left in the buffer and destroys the writer, but does not close its file
+ *
+ * Big-O: O(n)
+*/
+
+void destroyWriter(WRITER *wp)
+{
+    assert(wp != NULL);
+    flush(wp);
+    free(wp -> buf);
+    free(wp);
+
+    return;
+}
+
+/*
+ * Function: writeLong
+ *
+ * Description: writes an integer followed by a newline, forming the digits from the right two at a time
+ *
+ * Big-O: O(1) amortized
+*/
+
+void writeLong(WRITER *wp, long x)
+{
+    assert(wp != NULL);
+    char text[24], *p = text + sizeof(text);
+    unsigned long u = x < 0 ? -(unsigned long) x : (unsigned long) x;
+    uint32_t small;
+    int pair;
+
+    if (BLOCK - wp -> pos < sizeof(text))
+    {
+        flush(wp);
+    }
+
+    *--p = '\n';
+
+    while (u > UINT32_MAX)
+    {
+        pair = (u % 100) * 2;
+        u /= 100;
+        *--p = pairs[pair + 1];
+        *--p = pairs[pair];
+    }
+
+    //* 32-bit division by a constant is cheaper, and most values fit
+    small = u;
+    while (small >= 100)
+    {
+        pair = (small % 100) * 2;
+        small /= 100;
+        *--p = pairs[pair + 1];
+        *--p = pairs[pair];
+    }
+
+    if (small >= 10)
+    {
+        *--p = pairs[small * 2 + 1];
+        *--p = pairs[small * 2];
+    }
+    else
+    {
+        *--p = '0' + small;
+    }
+
+    if (x < 0)
+    {
+        *--p = '-';
+    }
+
+    memcpy(wp -> buf + wp -> pos, p, text + sizeof(text) - p);
+    wp -> pos += text + sizeof(text) - p;
+
+    return;
+}
@@ -6,8 +6,12 @@
  * Date: 02-26-2023
  * 
  * Description: This file defines functions that modify an list of unknown types in a variety of 
- *              ways defined by radix.c and maze.c. It contains two structs, createList,
- *              destroyList, numItems, addFirst, addLast, removeFirst, removeLast, getFirst, getLast, removeItem, findItem, and getItems.
+ *              ways defined by radix.c and maze.c. It contains three structs, allocNode, freeNode, createList,
+ *              destroyList, numItems, addFirst, addLast, removeFirst, removeLast, getFirst, getLast, removeItem, findItem, getItems, and spliceList.
+ *              Nodes come from a pool shared by every list, which is filled a slab of nodes at a time, so once the
+ *              pool is warm adding and removing items makes no calls to malloc or free. Destroying a list hands its
+ *              whole chain back to the pool at once, and the slabs are released when the last list is destroyed.
+ *              Like the lists themselves, the pool is not safe to use from more than one thread.
  */
 
 #include <stdio.h>
@@ -16,6 +20,8 @@
 #include <string.h>
 #include "list.h"
 
+#define SLAB_SIZE 512   //* nodes allocated at a time for the pool
+
 typedef struct node
 {
     void* data;
@@ -30,6 +36,65 @@ typedef struct list
     int (*compare)();
 }LIST;
 
+typedef struct slab
+{
+    struct slab *next;
+    NODE nodes[SLAB_SIZE];
+}SLAB;
+
+static NODE *pool;      //* free nodes, linked through next
+static SLAB *slabs;     //* every slab allocated for the pool
+static int lists;       //* number of lists that have not been destroyed
+
+/*
+ * Function:    allocNode
+ *
+ * Complexity:  O(1) amortized
+ *
+ * Description: Takes a node from the pool, allocating a new slab of nodes if the pool is empty.
+ */
+
+static NODE *allocNode(void)
+{
+    int i;
+    NODE *np;
+
+    if (pool == NULL)
+    {
+        SLAB *slab = malloc(sizeof(SLAB));
+        assert(slab != NULL);
+        slab -> next = slabs;
+        slabs = slab;
+
+        for (i = 0; i < SLAB_SIZE; i++)
+        {
+            slab -> nodes[i].next = pool;
+            pool = &slab -> nodes[i];
+        }
+    }
+
+    np = pool;
+    pool = np -> next;
+
+    return np;
+}
+
+/*
+ * Function:    freeNode
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns a node to the pool.
+ */
+
+static void freeNode(NODE *np)
+{
+    np -> next = pool;
+    pool = np;
+
+    return;
+}
+
 /*
  * Function:    createList
  * 
@@ -44,8 +109,8 @@ LIST *createList(int (*compare)())
     assert(lp != NULL);
     lp -> count = 0;
     lp -> compare = compare;
-    lp -> head = malloc(sizeof(NODE));
-    assert(lp -> head != NULL);
+    lp -> head = allocNode();
+    lists++;
     lp -> head -> prev = lp -> head;
     lp -> head -> next = lp -> head;
 
@@ -55,26 +120,33 @@ LIST *createList(int (*compare)())
 /*
  * Function:    destroyList
  * 
- * Complexity:  O(n)
+ * Complexity:  O(1)
  *
- * Description: Destroys a given list via freeing the pointer.
+ * Description: Destroys a given list via freeing the pointer. The circular chain of nodes, sentinel
+ *              included, is cut open and put on the front of the pool in one step.
  */
 
 void destroyList(LIST *lp)
 {
     assert(lp != NULL);
-    NODE* pDel;
-    NODE* pPrev = lp -> head -> prev;
+    SLAB *slab;
 
-    while (pDel != lp -> head)
+    lp -> head -> prev -> next = pool;
+    pool = lp -> head;
+    free(lp);
+
+    //* once no list is left, no node is in use, so the slabs can go back to the system
+    if (--lists == 0)
     {
-        pDel = pPrev;
-        pPrev = pDel -> prev;
-        free(pDel);
+        while (slabs != NULL)
+        {
+            slab = slabs;
+            slabs = slab -> next;
+            free(slab);
+        }
+        pool = NULL;
     }
 
-    free(lp);
-
     return;
 }
 
@@ -105,8 +177,7 @@ void addFirst(LIST *lp, void *item)
 {
     assert(lp != NULL && item != NULL);
 
-    NODE* pNew = malloc(sizeof(NODE));
-    assert(pNew != NULL);
+    NODE* pNew = allocNode();
 
     pNew -> data = item;
     lp -> head -> next -> prev = pNew;
@@ -130,8 +201,7 @@ void addLast(LIST *lp, void *item)
 {
     assert(lp != NULL && item != NULL);
 
-    NODE* pNew = malloc(sizeof(NODE));
-    assert(pNew != NULL);
+    NODE* pNew = allocNode();
 
     pNew -> data = item;
     lp -> head -> prev -> next = pNew;
@@ -160,7 +230,7 @@ void *removeFirst(LIST *lp)
 
     lp -> head -> next = pDel -> next;
     pDel -> next -> prev = lp -> head;
-    free(pDel);
+    freeNode(pDel);
     lp -> count--;
 
     return localData;
@@ -183,7 +253,7 @@ void *removeLast(LIST *lp)
 
     lp -> head -> prev = pDel -> prev;
     pDel -> prev -> next = lp -> head;
-    free(pDel);
+    freeNode(pDel);
     lp -> count--;
 
     return localData;
@@ -241,7 +311,7 @@ void removeItem(LIST *lp, void *item)
         {
             pCur -> prev -> next = pCur -> next;
             pCur -> next -> prev = pCur -> prev;
-            free(pCur);
+            freeNode(pCur);
             lp -> count--;
             break;
         }
@@ -309,4 +379,38 @@ void *getItems(LIST *lp)
     }
 
     return arr;
-}
\ No newline at end of file
+}
+
+/*
+ * Function:	spliceList
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Moves every item of src onto the back of dst, leaving src empty. Since every list draws its
+ *              nodes from the same pool, the nodes are relinked rather than copied.
+*/
+
+void spliceList(LIST *dst, LIST *src)
+{
+    assert(dst != NULL && src != NULL && dst != src);
+
+    if (src -> count == 0)
+    {
+        return;
+    }
+
+    NODE* pFirst = src -> head -> next;
+    NODE* pLast = src -> head -> prev;
+
+    dst -> head -> prev -> next = pFirst;
+    pFirst -> prev = dst -> head -> prev;
+    pLast -> next = dst -> head;
+    dst -> head -> prev = pLast;
+    dst -> count += src -> count;
+
+    src -> head -> next = src -> head;
+    src -> head -> prev = src -> head;
+    src -> count = 0;
+
+    return;
+}
@@ -7,7 +7,8 @@
  *		declarations for a list abstract data type for generic
  *		pointer types.  The list supports deque operations, in
  *		which items can be easily added to or removed from the
- *		front or rear of the list.
+ *		front or rear of the list, and one list can be moved onto
+ *		the end of another in constant time.
  */
 
 # ifndef LIST_H
@@ -39,4 +40,6 @@ extern void *findItem(LIST *lp, void *item);
 
 extern void *getItems(LIST *lp);
 
+extern void spliceList(LIST *dst, LIST *src);
+
 # endif /* LIST_H */
@@ -21,6 +21,7 @@
 # include <stdlib.h>
 # include <assert.h>
 # include "list.h"
+# include "intio.h"
 
 # define r 10
 
@@ -34,7 +35,10 @@
 int main(void)
 {
     int i, x, niter, div, max, *p;
+    long value;
     LIST *a, *lists[r];
+    READER *rp;
+    WRITER *wp;
 
 
     max = 0;
@@ -46,7 +50,11 @@ int main(void)
 
     /* Read in the numbers and record the maximum as we go along. */
 
-    while (scanf("%d", &x) == 1) {
+    rp = createReader(0);
+
+    while (readLong(rp, &value)) {
+	x = value;
+
 	if (x >= 0) {
 	    p = malloc(sizeof(int));
 	    assert(p != NULL);
@@ -63,6 +71,8 @@ int main(void)
 	}
     }
 
+    destroyReader(rp);
+
     div = 1;
     niter = ceil(log(max + 1) / log(r));
 
@@ -80,8 +90,7 @@ int main(void)
 	/* Move the numbers from the buckets back into the list. */
 
 	for (i = 0; i < r; i ++)
-	    while (numItems(lists[i]) > 0)
-		addLast(a, removeFirst(lists[i]));
+	    spliceList(a, lists[i]);
 
 	div = div * r;
     }
@@ -89,11 +98,15 @@ int main(void)
 
     /* Print out the numbers. */
 
+    wp = createWriter(1);
+
     while (numItems(a) > 0) {
 	p = removeFirst(a);
-	printf("%d\n", *p);
+	writeLong(wp, *p);
 	free(p);
     }
 
+    destroyWriter(wp);
+
     exit(EXIT_SUCCESS);
 }
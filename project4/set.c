@@ -6,37 +6,151 @@
  * Date: 02-26-2023
  * 
  * Description: This file defines functions that modify an set of unknown types in a hash table in a variety of 
- *              ways defined by unique.c and parity.c. It contains a struct, createSet,
- *              destroySet, numElements, addElement, removeElement, findElement, and getElement.
+ *              ways defined by unique.c and parity.c. It contains three structs, allocChunk, freeChunk, bucket,
+ *              address, createSet, destroySet, numElements, setLoadFactor, search, append, split, addElement,
+ *              removeElement, findElement, and getElement.
  *              Note: Decided to use an int flag called copy instead of a boolean flag for determining if
- *              an element is already in this list, hence why it is missing. Uses functions from list.c so each
- *              element in the hash table is a linked list
+ *              an element is already in this list, hence why it is missing. Each bucket of the hash table is
+ *              a chain of chunks, each one cache line long and holding up to seven elements. The first chunk
+ *              of every bucket is stored inline in the table and the rest come from a slab pool, so walking
+ *              a bucket reads memory in order and adding an element does not call malloc.
+ *              The table grows by linear hashing: whenever the average bucket holds more than its load factor,
+ *              addElement splits the next bucket or two in order, so the table grows a bucket at a time
+ *              instead of stopping to rehash everything.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <string.h>
-#include "list.h"
 #include "set.h"
-#define alpha 20
+#define alpha 5         //* default target for the average number of elements in a bucket
+#define SLOTS 7         //* elements per chunk, so a chunk and its next pointer fill a 64 byte cache line
+#define SLAB_SIZE 64    //* chunks allocated at a time for the pool
+#define SEGMENT 256     //* buckets in each segment of the table, a power of two
+#define SPLITS 2        //* most buckets split by a single addElement
+
+typedef struct chunk
+{
+    void *slots[SLOTS];     //* elements, packed to the front of the chain, NULL after the last one
+    struct chunk *next;     //* next chunk of the bucket
+}CHUNK;
+
+typedef struct slab
+{
+    struct slab *next;
+    CHUNK *chunks;
+}SLAB;
 
 struct set
 {
-    LIST **lists;
-    int length;
+    CHUNK **segments;   //* table of buckets, allocated one segment at a time so it never has to be copied
+    int nsegments;      //* length of the segments array
+    int length;         //* number of buckets in use
+    int base;           //* number of buckets at the start of this round of splits, a power of two
+    int next;           //* next bucket to split, buckets below it are addressed with twice the mask
+    int load;           //* target for the average number of elements in a bucket
     int count;
     int copy;
     int (*compare)();
     unsigned (*hash)();
+    CHUNK *free;        //* chunks returned to the pool
+    SLAB *slabs;        //* every slab allocated for the pool
 };
 
+/*
+ * Function:    allocChunk
+ *
+ * Complexity:  O(1) amortized
+ *
+ * Description: Takes an empty chunk from the pool, allocating a new slab of chunks if the pool is empty.
+ */
+
+static CHUNK *allocChunk(SET *sp)
+{
+    int i;
+    CHUNK *cp;
+
+    if (sp -> free == NULL)
+    {
+        SLAB *slab = malloc(sizeof(SLAB));
+        assert(slab != NULL);
+        slab -> chunks = aligned_alloc(64, sizeof(CHUNK) * SLAB_SIZE);
+        assert(slab -> chunks != NULL);
+        slab -> next = sp -> slabs;
+        sp -> slabs = slab;
+
+        for (i = 0; i < SLAB_SIZE; i++)
+        {
+            slab -> chunks[i].next = sp -> free;
+            sp -> free = &slab -> chunks[i];
+        }
+    }
+
+    cp = sp -> free;
+    sp -> free = cp -> next;
+    memset(cp, 0, sizeof(CHUNK));
+
+    return cp;
+}
+
+/*
+ * Function:    freeChunk
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns a chunk to the pool.
+ */
+
+static void freeChunk(SET *sp, CHUNK *cp)
+{
+    cp -> next = sp -> free;
+    sp -> free = cp;
+
+    return;
+}
+
+/*
+ * Function:    bucket
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns the first chunk of the bucket at a given index.
+ */
+
+static CHUNK *bucket(SET *sp, int index)
+{
+    return &sp -> segments[index / SEGMENT][index % SEGMENT];
+}
+
+/*
+ * Function:    address
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Returns the index of the bucket for a given hash value. Buckets that were already split in
+ *              this round are addressed with one more bit of the hash.
+ */
+
+static int address(SET *sp, unsigned key)
+{
+    int index = key & (sp -> base - 1);
+
+    if (index < sp -> next)
+    {
+        index = key & (sp -> base * 2 - 1);
+    }
+
+    return index;
+}
+
 /*
  * Function:    createSet
  * 
  * Complexity:  O(n)
  *
- * Description: Creates a set that returns a set pointer and takes a max number of elements.
+ * Description: Creates a set that returns a set pointer and takes a max number of elements. The number of
+ *              elements is only used to size the table to begin with, and the table grows past it as needed.
  */
 
 SET *createSet(int n, int (*compare)(), unsigned (*hash)())
@@ -46,16 +160,31 @@ SET *createSet(int n, int (*compare)(), unsigned (*hash)())
     assert(sp);
     sp -> compare = compare;
     sp -> hash = hash;
-    sp -> length = n / alpha;
+    sp -> base = SEGMENT;
+    while (sp -> base < n / alpha)
+    {
+        sp -> base *= 2;
+    }
+    sp -> length = sp -> base;
+    sp -> next = 0;
+    sp -> load = alpha;
     sp -> count = 0;
     sp -> copy = 0;
-    sp -> lists = malloc(sizeof(LIST*) * sp -> length);
-    assert(sp -> lists);
-    for (i = 0; i < sp -> length; i++)
+    sp -> free = NULL;
+    sp -> slabs = NULL;
+    sp -> nsegments = sp -> base / SEGMENT * 2;
+    sp -> segments = malloc(sizeof(CHUNK*) * sp -> nsegments);
+    assert(sp -> segments);
+    for (i = 0; i < sp -> nsegments; i++)
     {
-        sp -> lists[i] = createList(sp -> compare);
+        sp -> segments[i] = NULL;
+    }
+    for (i = 0; i < sp -> length / SEGMENT; i++)
+    {
+        sp -> segments[i] = aligned_alloc(64, sizeof(CHUNK) * SEGMENT);
+        assert(sp -> segments[i]);
+        memset(sp -> segments[i], 0, sizeof(CHUNK) * SEGMENT);
     }
-
 
     return sp;
 }
@@ -65,19 +194,29 @@ SET *createSet(int n, int (*compare)(), unsigned (*hash)())
  *
  * Complexity:  O(n)
  *
- * Description: Destroys a given set via freeing the pointer.
+ * Description: Destroys a given set via freeing the pointer. Overflow chunks are released a slab at a time.
  */
 
 void destroySet(SET* sp)
 {
     assert(sp != NULL);
-	int i;
-	for(i = 0; i < sp->length; i++)
-	{
-    	destroyList(sp -> lists[i]);
-	}
-    
-    free(sp->lists);
+    int i;
+    SLAB *slab;
+
+    while (sp -> slabs != NULL)
+    {
+        slab = sp -> slabs;
+        sp -> slabs = slab -> next;
+        free(slab -> chunks);
+        free(slab);
+    }
+
+    for (i = 0; i < sp -> nsegments; i++)
+    {
+        free(sp -> segments[i]);
+    }
+
+    free(sp -> segments);
     free(sp);
     return;
 }
@@ -96,23 +235,177 @@ int numElements(SET* sp)
     return sp -> count;
 }
 
+/*
+ * Function:    setLoadFactor
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Sets the target for the average number of elements in a bucket. The table only ever grows,
+ *              so lowering the target makes the following inserts split buckets until it is reached.
+ */
+
+void setLoadFactor(SET *sp, int load)
+{
+    assert(sp != NULL && load > 0);
+    sp -> load = load;
+    return;
+}
+
+/*
+ * Function:    search
+ *
+ * Complexity:  O(n)
+ *
+ * Description: Search function used by other functions in this file. Walks the bucket of a given element
+ *              once, setting the copy flag and the first chunk of the bucket, and returning the chunk and
+ *              slot of the element if it is found.
+ *              If it is not found, returns the chunk and slot just past the last element of the bucket,
+ *              where the slot is SLOTS if the last chunk is full.
+ */
+
+static CHUNK *search(SET *sp, void *elt, CHUNK **head, int *slot)
+{
+    assert(sp != NULL && elt != NULL);
+    int i;
+    CHUNK *cp = bucket(sp, address(sp, (sp -> hash)(elt)));
+    sp -> copy = 0;
+    *head = cp;
+
+    while (1)
+    {
+        for (i = 0; i < SLOTS && cp -> slots[i] != NULL; i++)
+        {
+            if ((*sp -> compare)(cp -> slots[i], elt) == 0)
+            {
+                sp -> copy = 1;
+                *slot = i;
+                return cp;
+            }
+        }
+
+        if (i < SLOTS || cp -> next == NULL)
+        {
+            *slot = i;
+            return cp;
+        }
+
+        cp = cp -> next;
+    }
+}
+
+/*
+ * Function:    append
+ *
+ * Complexity:  O(1)
+ *
+ * Description: Adds an element after the last element of a bucket, given the last chunk of the bucket and
+ *              the number of elements in it. Returns the new last chunk.
+ */
+
+static CHUNK *append(SET *sp, CHUNK *tail, int *fill, void *elt)
+{
+    if (*fill == SLOTS)
+    {
+        tail -> next = allocChunk(sp);
+        tail = tail -> next;
+        *fill = 0;
+    }
+
+    tail -> slots[(*fill)++] = elt;
+
+    return tail;
+}
+
+/*
+ * Function:    split
+ *
+ * Complexity:  O(alpha)
+ *
+ * Description: Splits the next bucket of the round, moving the elements that now address the new bucket at
+ *              the end of the table. Starts a new round once every bucket of this one has been split.
+ */
+
+static void split(SET *sp)
+{
+    int i, fill[2] = { 0, 0 };
+    CHUNK *cp, *next, *tail[2], old;
+    unsigned mask = sp -> base * 2 - 1;
+
+    if (sp -> length / SEGMENT == sp -> nsegments)
+    {
+        sp -> segments = realloc(sp -> segments, sizeof(CHUNK*) * sp -> nsegments * 2);
+        assert(sp -> segments);
+        for (i = sp -> nsegments; i < sp -> nsegments * 2; i++)
+        {
+            sp -> segments[i] = NULL;
+        }
+        sp -> nsegments *= 2;
+    }
+
+    if (sp -> length % SEGMENT == 0)
+    {
+        sp -> segments[sp -> length / SEGMENT] = aligned_alloc(64, sizeof(CHUNK) * SEGMENT);
+        assert(sp -> segments[sp -> length / SEGMENT]);
+        memset(sp -> segments[sp -> length / SEGMENT], 0, sizeof(CHUNK) * SEGMENT);
+    }
+
+    //* take the old chain out of the table, then deal its elements back out to the two buckets
+    tail[0] = bucket(sp, sp -> next);
+    tail[1] = bucket(sp, sp -> length);
+    old = *tail[0];
+    memset(tail[0], 0, sizeof(CHUNK));
+
+    for (cp = &old; cp != NULL; cp = next)
+    {
+        for (i = 0; i < SLOTS && cp -> slots[i] != NULL; i++)
+        {
+            int half = ((sp -> hash)(cp -> slots[i]) & mask) != sp -> next;
+            tail[half] = append(sp, tail[half], &fill[half], cp -> slots[i]);
+        }
+
+        next = cp -> next;
+        if (cp != &old)
+        {
+            freeChunk(sp, cp);
+        }
+    }
+
+    sp -> length++;
+    sp -> next++;
+    if (sp -> next == sp -> base)
+    {
+        sp -> base *= 2;
+        sp -> next = 0;
+    }
+
+    return;
+}
+
 /*
  * Function:    addElement
  *
  * Complexity:  O(n)
  *
- * Description: Adds a given element to a given set and places it in the hash table using functions from list.c.
+ * Description: Adds a given element to the end of its bucket in the hash table, then splits buckets if the
+ *              table is over its load factor.
  */
 
 void addElement(SET *sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int key = (sp -> hash)(elt) % sp -> length;
+    int i, slot;
+    CHUNK *head;
+    CHUNK *cp = search(sp, elt, &head, &slot);
 
-    if (findItem(sp -> lists[key], elt) == NULL)
+    if (sp -> copy == 0)
     {
-        addLast(sp -> lists[key], elt);
+        append(sp, cp, &slot, elt);
         sp -> count++;
+
+        for (i = 0; i < SPLITS && sp -> count > sp -> load * sp -> length; i++)
+        {
+            split(sp);
+        }
     }
 
     return;
@@ -123,18 +416,41 @@ void addElement(SET *sp, void *elt)
  *
  * Complexity:  O(n)
  *
- * Description: Removes a given element from a given set by using functions from list.c.
+ * Description: Removes a given element from a given set. The last element of the bucket is moved into its
+ *              slot so the bucket stays packed, and an overflow chunk is returned to the pool once it is empty.
  */
 
 void removeElement(SET* sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int key = (sp -> hash)(elt) % sp -> length;
+    int slot, last;
+    CHUNK *head, *prev = NULL;
+    CHUNK *cp = search(sp, elt, &head, &slot);
+    CHUNK *end = head;
 
-    if (findItem(sp -> lists[key], elt) != NULL)
+    if (sp -> copy == 0)
     {
-        removeItem(sp -> lists[key], elt);
-        sp -> count--;
+        return;
+    }
+
+    //* find the last element of the bucket, which is in the last chunk
+    while (end -> next != NULL)
+    {
+        prev = end;
+        end = end -> next;
+    }
+
+    for (last = SLOTS - 1; end -> slots[last] == NULL; last--)
+        ;
+
+    cp -> slots[slot] = end -> slots[last];
+    end -> slots[last] = NULL;
+    sp -> count--;
+
+    if (last == 0 && prev != NULL)
+    {
+        prev -> next = NULL;
+        freeChunk(sp, end);
     }
 
     return;
@@ -145,20 +461,22 @@ void removeElement(SET* sp, void *elt)
  *
  * Complexity:  O(n)
  *
- * Description: Finds a given element in a given set. Returns NULL if it was not found. Uses functions from list.c
+ * Description: Finds a given element in a given set. Returns NULL if it was not found.
  */
 
 void *findElement(SET *sp, void *elt)
 {
     assert(sp != NULL && elt != NULL);
-    int key = (sp -> hash)(elt) % sp -> length;
+    int slot;
+    CHUNK *head;
+    CHUNK *cp = search(sp, elt, &head, &slot);
 
-    if (findItem(sp -> lists[key], elt) == NULL)
+    if (sp -> copy == 0)
     {
         return NULL;
     }
 
-    return findItem(sp -> lists[key], elt);
+    return cp -> slots[slot];
 }
 
 /*
@@ -173,17 +491,20 @@ void *getElements(SET* sp)
 {
     assert(sp != NULL);
     int i, j, temp = 0;
-    void **arr = malloc(sizeof(LIST*) * sp -> count);
+    CHUNK *cp;
+    void **arr = malloc(sizeof(void*) * sp -> count);
     assert(arr != NULL);
     for (i = 0; i < sp -> length; i++)
     {
-        void **tempList = getItems(sp -> lists[i]);
-        for (j = 0; j < numItems(sp -> lists[i]); j++)
+        for (cp = bucket(sp, i); cp != NULL; cp = cp -> next)
         {
-            arr[temp] = tempList[j];
-            temp++;
+            for (j = 0; j < SLOTS && cp -> slots[j] != NULL; j++)
+            {
+                arr[temp] = cp -> slots[j];
+                temp++;
+            }
         }
     }
 
     return arr;
-}
\ No newline at end of file
+}
@@ -20,6 +20,8 @@ void destroySet(SET *sp);
 
 int numElements(SET *sp);
 
+void setLoadFactor(SET *sp, int load);
+
 void addElement(SET *sp, void *elt);
 
 void removeElement(SET *sp, void *elt);
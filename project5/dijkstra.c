@@ -0,0 +1,448 @@
+/*
+ * File Name: dijkstra.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Finds the cheapest path through a weighted maze with Dijkstra's algorithm, once with the
+ *              indexed priority queue, once with the plain priority queue, and once with the radix heap, and
+ *              prints the cost, the work done, and the time of each. The maze is a grid built by depth-first
+ *              search like the one in maze.c, with some extra walls knocked down so there is more than one
+ *              way through, and each passage between two cells costs from 1 to 9 to cross. The indexed search
+ *              keeps one entry per cell and lowers it in place with decreaseKey. The plain search adds a new
+ *              entry every time it finds a cheaper way to a cell and skips the stale ones as they come out,
+ *              which is what a maze solver had to do before. The radix heap search adds duplicates the same
+ *              way, but its keys are the distances themselves, which come out in order that never decreases,
+ *              so it needs no comparisons. All three find the same cost. These functions include distcmp,
+ *              itemcmp, now, buildMaze, neighbors, solveIndexed, solvePlain, solveRadix, and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <assert.h>
+#include <time.h>
+#include "pqueue.h"
+#include "ipqueue.h"
+#include "rheap.h"
+
+#define OPEN 4      //* one wall in this many is knocked down after the maze is built
+
+typedef struct item
+{
+    int dist;
+    int cell;
+}ITEM;
+
+int width;
+int height;
+char *right;        //* cost of the passage on the right of each cell, or 0 if there is a wall
+char *bottom;       //* cost of the passage below each cell, or 0 if there is a wall
+int *dist;          //* cheapest known cost of reaching each cell
+long pushes;        //* entries added to a queue
+long decreases;     //* entries lowered in place
+int settled;        //* cells removed from a queue for the last time
+
+/* Function: distcmp
+ *
+ * Description: compares two distances through pointers to them
+ *
+ * Big-O: O(1)
+*/
+
+static int distcmp(int *d1, int *d2)
+{
+    return (*d1 < *d2) ? -1 : (*d1 > *d2);
+}
+
+/* Function: itemcmp
+ *
+ * Description: compares two items by their distances
+ *
+ * Big-O: O(1)
+*/
+
+static int itemcmp(ITEM *i1, ITEM *i2)
+{
+    return (i1 -> dist < i2 -> dist) ? -1 : (i1 -> dist > i2 -> dist);
+}
+
+/* Function: now
+ *
+ * Description: returns the time in seconds
+ *
+ * Big-O: O(1)
+*/
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Function: buildMaze
+ *
+ * Description: builds the maze with a depth-first search from the first cell, keeping its own stack instead of
+ *              recursing so large mazes do not run out of stack, then knocks down some of the remaining walls.
+ *              Each passage is given a random cost as it is opened.
+ *
+ * Big-O: O(n)
+*/
+
+static void buildMaze(void)
+{
+    int n = width * height, top = 0, count, cell, next, i;
+    int *stack = malloc(sizeof(int) * n), choices[4];
+    char *visited = calloc(n, 1);
+    assert(stack != NULL && visited != NULL);
+
+    for (i = 0; i < n; i++)
+    {
+        right[i] = bottom[i] = 0;
+    }
+
+    stack[top++] = 0;
+    visited[0] = 1;
+    while (top > 0)
+    {
+        cell = stack[top - 1];
+        count = 0;
+        if (cell >= width && !visited[cell - width])
+        {
+            choices[count++] = cell - width;
+        }
+        if (cell < n - width && !visited[cell + width])
+        {
+            choices[count++] = cell + width;
+        }
+        if (cell % width > 0 && !visited[cell - 1])
+        {
+            choices[count++] = cell - 1;
+        }
+        if (cell % width < width - 1 && !visited[cell + 1])
+        {
+            choices[count++] = cell + 1;
+        }
+
+        if (count == 0)
+        {
+            top--;
+            continue;
+        }
+
+        //* break the wall between the cell and a random unvisited neighbor, and go there
+        next = choices[rand() % count];
+        if (next == cell - width)
+        {
+            bottom[next] = 1 + rand() % 9;
+        }
+        else if (next == cell + width)
+        {
+            bottom[cell] = 1 + rand() % 9;
+        }
+        else if (next == cell - 1)
+        {
+            right[next] = 1 + rand() % 9;
+        }
+        else
+        {
+            right[cell] = 1 + rand() % 9;
+        }
+        visited[next] = 1;
+        stack[top++] = next;
+    }
+
+    //* a perfect maze has only one path, so open some more walls to give the search a choice
+    for (i = 0; i < n; i++)
+    {
+        if (i % width < width - 1 && !right[i] && rand() % OPEN == 0)
+        {
+            right[i] = 1 + rand() % 9;
+        }
+        if (i < n - width && !bottom[i] && rand() % OPEN == 0)
+        {
+            bottom[i] = 1 + rand() % 9;
+        }
+    }
+
+    free(stack);
+    free(visited);
+
+    return;
+}
+
+/* Function: neighbors
+ *
+ * Description: stores the cells that can be reached from a cell in one step and the costs of getting there,
+ *              and returns how many there are
+ *
+ * Big-O: O(1)
+*/
+
+static int neighbors(int cell, int next[4], int cost[4])
+{
+    int count = 0;
+
+    if (cell % width < width - 1 && right[cell])
+    {
+        cost[count] = right[cell];
+        next[count++] = cell + 1;
+    }
+    if (cell < width * (height - 1) && bottom[cell])
+    {
+        cost[count] = bottom[cell];
+        next[count++] = cell + width;
+    }
+    if (cell % width > 0 && right[cell - 1])
+    {
+        cost[count] = right[cell - 1];
+        next[count++] = cell - 1;
+    }
+    if (cell >= width && bottom[cell - width])
+    {
+        cost[count] = bottom[cell - width];
+        next[count++] = cell - width;
+    }
+
+    return count;
+}
+
+/* Function: solveIndexed
+ *
+ * Description: finds the cost of the cheapest path from the first cell to the last with the indexed queue,
+ *              whose entries are the distances of the cells
+ *
+ * Big-O: O(n log n)
+*/
+
+static int solveIndexed(void)
+{
+    int n = width * height, cell, count, d, i, next[4], cost[4];
+    IPQ *ipq = createIndexedQueue(n, distcmp);
+
+    for (i = 0; i < n; i++)
+    {
+        dist[i] = INT_MAX;
+    }
+    pushes = decreases = settled = 0;
+
+    dist[0] = 0;
+    addHandle(ipq, 0, &dist[0]);
+    pushes++;
+
+    while (numIndexedEntries(ipq) > 0)
+    {
+        cell = removeIndexedMin(ipq);
+        settled++;
+        if (cell == n - 1)
+        {
+            break;
+        }
+
+        count = neighbors(cell, next, cost);
+        for (i = 0; i < count; i++)
+        {
+            d = dist[cell] + cost[i];
+            if (d < dist[next[i]])
+            {
+                //* a cell that has never been reached is added, and one still waiting is lowered in place
+                if (dist[next[i]] == INT_MAX)
+                {
+                    dist[next[i]] = d;
+                    addHandle(ipq, next[i], &dist[next[i]]);
+                    pushes++;
+                }
+                else
+                {
+                    dist[next[i]] = d;
+                    decreaseKey(ipq, next[i], &dist[next[i]]);
+                    decreases++;
+                }
+            }
+        }
+    }
+
+    destroyIndexedQueue(ipq);
+
+    return dist[n - 1];
+}
+
+/* Function: solvePlain
+ *
+ * Description: finds the cost of the cheapest path from the first cell to the last with the plain queue,
+ *              adding a new item whenever a distance is lowered and skipping items that are out of date
+ *
+ * Big-O: O(n log n)
+*/
+
+static int solvePlain(void)
+{
+    int n = width * height, cell, count, d, i, next[4], cost[4];
+    PQ *pq = createQueue(itemcmp);
+    ITEM *item;
+
+    for (i = 0; i < n; i++)
+    {
+        dist[i] = INT_MAX;
+    }
+    pushes = decreases = settled = 0;
+
+    dist[0] = 0;
+    item = malloc(sizeof(ITEM));
+    assert(item != NULL);
+    item -> dist = 0;
+    item -> cell = 0;
+    addEntry(pq, item);
+    pushes++;
+
+    while (numEntries(pq) > 0)
+    {
+        item = removeEntry(pq);
+        cell = item -> cell;
+        d = item -> dist;
+        free(item);
+
+        if (d > dist[cell])
+        {
+            continue;
+        }
+        settled++;
+        if (cell == n - 1)
+        {
+            break;
+        }
+
+        count = neighbors(cell, next, cost);
+        for (i = 0; i < count; i++)
+        {
+            d = dist[cell] + cost[i];
+            if (d < dist[next[i]])
+            {
+                dist[next[i]] = d;
+                item = malloc(sizeof(ITEM));
+                assert(item != NULL);
+                item -> dist = d;
+                item -> cell = next[i];
+                addEntry(pq, item);
+                pushes++;
+            }
+        }
+    }
+
+    destroyQueue(pq);
+
+    return dist[n - 1];
+}
+
+/* Function: solveRadix
+ *
+ * Description: finds the cost of the cheapest path from the first cell to the last with the radix heap, whose
+ *              keys are distances and whose entries point to the distance of their cells. A key larger than
+ *              the distance of its cell is out of date and skipped.
+ *
+ * Big-O: O(n log C), where C is the cost of the path
+*/
+
+static int solveRadix(void)
+{
+    int n = width * height, cell, count, d, i, next[4], cost[4];
+    RHEAP *rh = createRadixHeap();
+    unsigned key;
+
+    for (i = 0; i < n; i++)
+    {
+        dist[i] = INT_MAX;
+    }
+    pushes = decreases = settled = 0;
+
+    dist[0] = 0;
+    addRadixEntry(rh, 0, &dist[0]);
+    pushes++;
+
+    while (numRadixEntries(rh) > 0)
+    {
+        cell = (int *) removeRadixEntry(rh, &key) - dist;
+        if (key > dist[cell])
+        {
+            continue;
+        }
+        settled++;
+        if (cell == n - 1)
+        {
+            break;
+        }
+
+        count = neighbors(cell, next, cost);
+        for (i = 0; i < count; i++)
+        {
+            d = dist[cell] + cost[i];
+            if (d < dist[next[i]])
+            {
+                dist[next[i]] = d;
+                addRadixEntry(rh, d, &dist[next[i]]);
+                pushes++;
+            }
+        }
+    }
+
+    //* the entries point into the distances, so they must not be freed with the heap
+    while (numRadixEntries(rh) > 0)
+    {
+        removeRadixEntry(rh, NULL);
+    }
+    destroyRadixHeap(rh);
+
+    return dist[n - 1];
+}
+
+/* Function: main
+ *
+ * Description: driver function for the program, usage: dijkstra [width [height [seed]]]
+ *
+ * Big-O: O(n log n)
+*/
+
+int main(int argc, char *argv[])
+{
+    int n, indexed, plain, radix;
+    double start;
+
+    width = argc > 1 ? atoi(argv[1]) : 1000;
+    height = argc > 2 ? atoi(argv[2]) : width;
+    if (width < 1 || height < 1 || argc > 4 || (long) width * height > INT_MAX)
+    {
+        fprintf(stderr, "usage: dijkstra [width [height [seed]]]\n");
+        exit(EXIT_FAILURE);
+    }
+    srand(argc > 3 ? atoi(argv[3]) : 1);
+
+    n = width * height;
+    right = malloc(n);
+    bottom = malloc(n);
+    dist = malloc(sizeof(int) * n);
+    assert(right != NULL && bottom != NULL && dist != NULL);
+    buildMaze();
+
+    start = now();
+    indexed = solveIndexed();
+    printf("indexed: cost %d, %d settled, %ld added, %ld decreased, %.3f s\n",
+           indexed, settled, pushes, decreases, now() - start);
+
+    start = now();
+    plain = solvePlain();
+    printf("plain:   cost %d, %d settled, %ld added, %.3f s\n", plain, settled, pushes, now() - start);
+
+    start = now();
+    radix = solveRadix();
+    printf("radix:   cost %d, %d settled, %ld added, %.3f s\n", radix, settled, pushes, now() - start);
+
+    assert(indexed == plain && plain == radix);
+    free(right);
+    free(bottom);
+    free(dist);
+
+    return 0;
+}
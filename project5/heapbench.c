@@ -0,0 +1,119 @@
+/*
+ * File Name: heapbench.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Measures the priority queue on the two ways this project uses it. The sort workload adds n
+ *              random integers and then removes them all, as sort.c does. The merge workload keeps k entries
+ *              in the queue and repeatedly removes the smallest and adds a new one, as huffman.c and the
+ *              k-way merge in sort.c do. The time and the number of comparisons are printed for each, so the
+ *              program can be linked against pqueue.c built with different values of ARITY. It contains
+ *              intcmp, now, and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <time.h>
+#include "pqueue.h"
+
+static long compares;   //* comparisons made by the queue
+
+/*
+ * Function: intcmp
+ *
+ * Description: compares two integers through pointers to them, counting the comparison
+ *
+ * Big-O: O(1)
+*/
+
+static int intcmp(int *i1, int *i2)
+{
+    compares++;
+    return (*i1 < *i2) ? -1 : (*i1 > *i2);
+}
+
+/*
+ * Function: now
+ *
+ * Description: returns the time in seconds
+ *
+ * Big-O: O(1)
+*/
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Function: main
+ *
+ * Description: driver function for the benchmark, usage: heapbench [n [k]]
+ *
+ * Big-O: O(n log n)
+*/
+
+int main(int argc, char *argv[])
+{
+    int i, n = argc > 1 ? atoi(argv[1]) : 1000000, k = argc > 2 ? atoi(argv[2]) : 1024;
+    int *values, *p, last;
+    double start;
+    PQ *pq;
+
+    assert(n > 0 && k > 0 && k <= n);
+    values = malloc(sizeof(int) * n);
+    assert(values != NULL);
+    srand(1);
+    for (i = 0; i < n; i++)
+    {
+        values[i] = rand();
+    }
+
+    //* sort workload: add everything, then remove everything
+    pq = createQueue(intcmp);
+    compares = 0;
+    start = now();
+    for (i = 0; i < n; i++)
+    {
+        addEntry(pq, &values[i]);
+    }
+    for (i = 0, last = -1; i < n; i++)
+    {
+        p = removeEntry(pq);
+        assert(*p >= last);
+        last = *p;
+    }
+    printf("sort  n=%d: %.3f s, %.1f compares per entry\n", n, now() - start, (double) compares / n);
+    destroyQueue(pq);
+
+    //* merge workload: keep k entries, replacing the smallest each time
+    pq = createQueue(intcmp);
+    for (i = 0; i < k; i++)
+    {
+        addEntry(pq, &values[i]);
+    }
+    compares = 0;
+    start = now();
+    for (i = k; i < n; i++)
+    {
+        p = removeEntry(pq);
+        values[i] = *p + values[i] % 1024;
+        addEntry(pq, &values[i]);
+    }
+    printf("merge k=%d: %.3f s, %.1f compares per step\n", k, now() - start, (double) compares / (n - k));
+    while (numEntries(pq) > 0)
+    {
+        removeEntry(pq);
+    }
+    destroyQueue(pq);
+
+    free(values);
+
+    return 0;
+}
@@ -21,17 +21,24 @@ typedef struct node NODE;
 
 int count[257];
 NODE* nodes[257];
+int made;           //* nodes made so far
 
 /* Function: compare
  * 
- * Description: compares data in 2 nodes
+ * Description: compares data in 2 nodes, breaking ties by the order the nodes were made so that the tree does
+ *              not depend on how the queue happens to arrange equal entries
  * 
  * Big-O: O(1)
 */
 static int compare(NODE *t1, NODE *t2)
 {
     assert(t1 != NULL && t2 != NULL);
-    return ((t1 -> count < t2 -> count) ? -1 : (t1 -> count > t2 -> count));
+    if (t1 -> count != t2 -> count)
+    {
+        return (t1 -> count < t2 -> count) ? -1 : 1;
+    }
+
+    return (t1 -> order < t2 -> order) ? -1 : (t1 -> order > t2 -> order);
 }
 
 /* Function: mknode
@@ -45,6 +52,7 @@ static NODE* mknode(int data, NODE *left_node, NODE *right_node)
     NODE* new_node = malloc(sizeof(NODE));
     assert(new_node != NULL);
     new_node -> count = data;
+    new_node -> order = made++;
     new_node -> parent = NULL;
     if (left_node != NULL)
     {
@@ -120,18 +128,22 @@ int main(int argc, char *argv[])
         readFile(argv[1]);
     }
 
-    PQ* pq = createQueue(compare);
-    int i;
+    //* collect the leaves, then build the queue from all of them at once; compare breaks ties by node order,
+    //* so this gives the same tree as adding the leaves one at a time
+    NODE* leaves[257];
+    int i, n = 0;
     for (i = 0; i < 256; i++)
     {
         if (count[i] > 0)
         {
             nodes[i] = mknode(count[i], NULL, NULL);
-            addEntry(pq, nodes[i]);
+            leaves[n++] = nodes[i];
         }
     }
     nodes[256] = mknode(0, NULL, NULL);
-    addEntry(pq, nodes[256]);
+    leaves[n++] = nodes[256];
+
+    PQ* pq = createQueueFrom((void**) leaves, n, compare);
 
     while(numEntries(pq) > 1)
     {
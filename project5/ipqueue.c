@@ -0,0 +1,271 @@
+/*
+ * File Name: ipqueue.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines an indexed priority queue. It is the same d-ary heap as pqueue.c, but each
+ *              entry is added under an integer handle, and a position map records where each handle is in the
+ *              heap. This lets an entry be made smaller or removed from the middle of the heap in O(log n),
+ *              so a shortest path search can lower a distance in place instead of adding a second copy of it.
+ *              Each slot of the heap holds the entry next to its handle, so the comparisons read only the heap
+ *              and the map is touched once per move. The queue does not own its entries and never frees them.
+ *              It contains a struct ipqueue, place, siftUp, siftDown, createIndexedQueue, destroyIndexedQueue,
+ *              numIndexedEntries, containsIndexed, addHandle, decreaseKey, removeHandle, and removeIndexedMin.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "ipqueue.h"
+
+#define LINE 64          //* cache line size in bytes
+
+//* number of children of each entry, chosen when compiling
+#ifndef ARITY
+#define ARITY 4
+#endif
+
+#define p(x) (((x) - 1) / ARITY)
+#define c(x) ((x) * ARITY + 1)
+
+//* the root is stored ARITY - 1 slots in, so with the array aligned each group of children starts a line
+#define OFFSET (ARITY - 1)
+
+typedef struct slot
+{
+    void *entry;
+    int handle;
+}SLOT;
+
+typedef struct ipqueue
+{
+    int count;
+    int capacity;
+    SLOT *base;
+    SLOT *data;
+    int *pos;           //* slot of each handle in the heap, or -1 if it is not in the queue
+    int (*compare)();
+}IPQ;
+
+/* Function: place
+ *
+ * Description: Stores an entry and its handle in a slot of the heap and records where the handle is
+ *
+ * Big-O: O(1)
+*/
+static void place(IPQ *ipq, int locate, void *entry, int handle)
+{
+    ipq -> data[locate].entry = entry;
+    ipq -> data[locate].handle = handle;
+    ipq -> pos[handle] = locate;
+
+    return;
+}
+
+/* Function: siftUp
+ *
+ * Description: Places an entry into the hole at the given slot, moving the parents larger than the entry
+ *              down into the hole until the entry's place is found
+ *
+ * Big-O: O(log n)
+*/
+static void siftUp(IPQ *ipq, int locate, void *entry, int handle)
+{
+    while (locate > 0 && (*ipq -> compare)(ipq -> data[p(locate)].entry, entry) > 0)
+    {
+        place(ipq, locate, ipq -> data[p(locate)].entry, ipq -> data[p(locate)].handle);
+        locate = p(locate);
+    }
+    place(ipq, locate, entry, handle);
+
+    return;
+}
+
+/* Function: siftDown
+ *
+ * Description: Places an entry into the hole at the given slot, moving the smallest of the children up into
+ *              the hole while it is smaller than the entry
+ *
+ * Big-O: O(log n)
+*/
+static void siftDown(IPQ *ipq, int locate, void *entry, int handle)
+{
+    int smallest, child, end;
+
+    while (c(locate) < ipq -> count)
+    {
+        smallest = c(locate);
+        end = smallest + ARITY < ipq -> count ? smallest + ARITY : ipq -> count;
+        for (child = smallest + 1; child < end; child++)
+        {
+            if ((*ipq -> compare)(ipq -> data[child].entry, ipq -> data[smallest].entry) < 0)
+            {
+                smallest = child;
+            }
+        }
+
+        if ((*ipq -> compare)(entry, ipq -> data[smallest].entry) <= 0)
+        {
+            break;
+        }
+
+        place(ipq, locate, ipq -> data[smallest].entry, ipq -> data[smallest].handle);
+        locate = smallest;
+    }
+    place(ipq, locate, entry, handle);
+
+    return;
+}
+
+/* Function: createIndexedQueue
+ *
+ * Description: Creates a new queue for the handles from 0 up to but not including the capacity. All of the
+ *              memory is allocated here, so the queue never grows.
+ *
+ * Big-O: O(n)
+*/
+IPQ *createIndexedQueue(int capacity, int (*compare)())
+{
+    assert(capacity > 0 && compare != NULL);
+    IPQ *ipq = malloc(sizeof(IPQ));
+    assert(ipq != NULL);
+    ipq -> count = 0;
+    ipq -> capacity = capacity;
+    ipq -> compare = compare;
+
+    size_t size = sizeof(SLOT) * ((size_t) capacity + OFFSET);
+    ipq -> base = aligned_alloc(LINE, (size + LINE - 1) / LINE * LINE);
+    ipq -> pos = malloc(sizeof(int) * capacity);
+    assert(ipq -> base != NULL && ipq -> pos != NULL);
+    ipq -> data = ipq -> base + OFFSET;
+
+    int i;
+    for (i = 0; i < capacity; i++)
+    {
+        ipq -> pos[i] = -1;
+    }
+
+    return ipq;
+}
+
+/* Function: destroyIndexedQueue
+ *
+ * Description: Destroys a given queue, but not the entries still in it
+ *
+ * Big-O: O(1)
+*/
+void destroyIndexedQueue(IPQ *ipq)
+{
+    assert(ipq != NULL);
+    free(ipq -> base);
+    free(ipq -> pos);
+    free(ipq);
+
+    return;
+}
+
+/* Function: numIndexedEntries
+ *
+ * Description: Returns the number of entries in the queue
+ *
+ * Big-O: O(1)
+*/
+int numIndexedEntries(IPQ *ipq)
+{
+    assert(ipq != NULL);
+
+    return ipq -> count;
+}
+
+/* Function: containsIndexed
+ *
+ * Description: Returns whether the given handle has an entry in the queue
+ *
+ * Big-O: O(1)
+*/
+int containsIndexed(IPQ *ipq, int handle)
+{
+    assert(ipq != NULL && handle >= 0 && handle < ipq -> capacity);
+
+    return ipq -> pos[handle] >= 0;
+}
+
+/* Function: addHandle
+ *
+ * Description: Adds an entry under a handle that is not already in the queue
+ *
+ * Big-O: O(log n)
+*/
+void addHandle(IPQ *ipq, int handle, void *entry)
+{
+    assert(ipq != NULL && entry != NULL && !containsIndexed(ipq, handle));
+
+    siftUp(ipq, ipq -> count++, entry, handle);
+
+    return;
+}
+
+/* Function: decreaseKey
+ *
+ * Description: Replaces the entry of a handle in the queue with one that is no larger, which may be the same
+ *              entry after its value has been lowered, and moves it up to its new place
+ *
+ * Big-O: O(log n)
+*/
+void decreaseKey(IPQ *ipq, int handle, void *entry)
+{
+    assert(ipq != NULL && entry != NULL && containsIndexed(ipq, handle));
+
+    siftUp(ipq, ipq -> pos[handle], entry, handle);
+
+    return;
+}
+
+/* Function: removeHandle
+ *
+ * Description: Removes the entry of a handle in the queue and returns it. The last entry fills the hole and
+ *              moves up or down to its place.
+ *
+ * Big-O: O(log n)
+*/
+void *removeHandle(IPQ *ipq, int handle)
+{
+    assert(ipq != NULL && containsIndexed(ipq, handle));
+
+    int locate = ipq -> pos[handle];
+    void *entry = ipq -> data[locate].entry;
+    SLOT last = ipq -> data[--ipq -> count];
+
+    ipq -> pos[handle] = -1;
+    if (locate < ipq -> count)
+    {
+        if (locate > 0 && (*ipq -> compare)(ipq -> data[p(locate)].entry, last.entry) > 0)
+        {
+            siftUp(ipq, locate, last.entry, last.handle);
+        }
+        else
+        {
+            siftDown(ipq, locate, last.entry, last.handle);
+        }
+    }
+
+    return entry;
+}
+
+/* Function: removeIndexedMin
+ *
+ * Description: Removes the smallest entry in the queue and returns its handle
+ *
+ * Big-O: O(log n)
+*/
+int removeIndexedMin(IPQ *ipq)
+{
+    assert(ipq != NULL && ipq -> count > 0);
+
+    int handle = ipq -> data[0].handle;
+    removeHandle(ipq, handle);
+
+    return handle;
+}
@@ -0,0 +1,32 @@
+/*
+ * File:	ipqueue.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for an indexed priority queue abstract data
+ *		type.  Each entry is named by an integer handle less than
+ *		the capacity of the queue, so an entry can be found, made
+ *		smaller, or removed without searching for it.
+ */
+
+# ifndef IPQUEUE_H
+# define IPQUEUE_H
+
+typedef struct ipqueue IPQ;
+
+IPQ *createIndexedQueue(int capacity, int (*compare)());
+
+void destroyIndexedQueue(IPQ *ipq);
+
+int numIndexedEntries(IPQ *ipq);
+
+int containsIndexed(IPQ *ipq, int handle);
+
+void addHandle(IPQ *ipq, int handle, void *entry);
+
+void decreaseKey(IPQ *ipq, int handle, void *entry);
+
+void *removeHandle(IPQ *ipq, int handle);
+
+int removeIndexedMin(IPQ *ipq);
+
+# endif /* IPQUEUE_H */
@@ -0,0 +1,312 @@
+/*
+ * File Name: mqbench.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Measures the MultiQueue against a single priority queue behind one lock, with several threads
+ *              that each repeatedly remove an entry and add a new one with a random key, as the workers of a
+ *              scheduler do. The throughput of each is printed. The MultiQueue is then run again with a record
+ *              of every key in the queue, kept in a Fenwick tree behind its own lock, and each removal looks up
+ *              how many smaller keys were still in the queue. The mean and largest of these rank errors are
+ *              printed; a single locked queue always has a rank error of 0. Because the record is updated just
+ *              after the queue, the ranks are approximate when threads run at the same time. It contains
+ *              intcmp, now, record, rank, worker, run, and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <time.h>
+#include <pthread.h>
+#include "pqueue.h"
+#include "mqueue.h"
+
+#define RANGE (1 << 20)     //* keys are from 0 up to but not including this
+#define MAX_THREADS 256
+
+enum { LOCKED, MULTI, RANKED };
+
+typedef struct worker
+{
+    pthread_t thread;
+    int *keys;          //* a fresh key for each entry the thread adds, so no entry is changed while queued
+    int ops;
+    unsigned seed;
+    long ranks;         //* total rank error of the entries removed
+    int worst;          //* largest rank error of an entry removed
+}WORKER;
+
+int mode;
+PQ *pq;
+MQ *mq;
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;          //* guards the locked queue
+pthread_mutex_t recordLock = PTHREAD_MUTEX_INITIALIZER;    //* guards the record of keys
+int *tree;              //* Fenwick tree counting the keys in the queue
+
+/*
+ * Function: intcmp
+ *
+ * Description: compares two integers through pointers to them
+ *
+ * Big-O: O(1)
+*/
+
+static int intcmp(int *i1, int *i2)
+{
+    return (*i1 < *i2) ? -1 : (*i1 > *i2);
+}
+
+/*
+ * Function: now
+ *
+ * Description: returns the time in seconds
+ *
+ * Big-O: O(1)
+*/
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Function: record
+ *
+ * Description: adds a change to the count of a key in the record
+ *
+ * Big-O: O(log RANGE)
+*/
+
+static void record(int key, int change)
+{
+    for (key++; key <= RANGE; key += key & -key)
+    {
+        tree[key] += change;
+    }
+
+    return;
+}
+
+/*
+ * Function: rank
+ *
+ * Description: returns how many keys in the record are smaller than the given key
+ *
+ * Big-O: O(log RANGE)
+*/
+
+static int rank(int key)
+{
+    int count = 0;
+
+    for (; key > 0; key -= key & -key)
+    {
+        count += tree[key];
+    }
+
+    return count;
+}
+
+/*
+ * Function: worker
+ *
+ * Description: removes an entry and adds a new one the given number of times, using the queue for the mode
+ *
+ * Big-O: O(n log n)
+*/
+
+static void *worker(void *arg)
+{
+    WORKER *wp = arg;
+    int i, *entry, r;
+
+    for (i = 0; i < wp -> ops; i++)
+    {
+        if (mode == LOCKED)
+        {
+            pthread_mutex_lock(&lock);
+            entry = removeEntry(pq);
+            pthread_mutex_unlock(&lock);
+        }
+        else
+        {
+            entry = removeMultiEntry(mq);
+        }
+        assert(entry != NULL);
+
+        if (mode == RANKED)
+        {
+            pthread_mutex_lock(&recordLock);
+            r = rank(*entry);
+            record(*entry, -1);
+            pthread_mutex_unlock(&recordLock);
+            wp -> ranks += r;
+            wp -> worst = r > wp -> worst ? r : wp -> worst;
+        }
+
+        entry = &wp -> keys[i];
+        *entry = rand_r(&wp -> seed) % RANGE;
+
+        if (mode == LOCKED)
+        {
+            pthread_mutex_lock(&lock);
+            addEntry(pq, entry);
+            pthread_mutex_unlock(&lock);
+        }
+        else
+        {
+            //* record the key first, so it is always there when another thread removes the entry
+            if (mode == RANKED)
+            {
+                pthread_mutex_lock(&recordLock);
+                record(*entry, 1);
+                pthread_mutex_unlock(&recordLock);
+            }
+            addMultiEntry(mq, entry);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Function: run
+ *
+ * Description: fills the queue for the mode with the given number of entries, runs the workers, and returns
+ *              the number of operations per second, then empties the queue
+ *
+ * Big-O: O(n log n)
+*/
+
+static double run(WORKER *workers, int threads, int *initial, int k)
+{
+    double start, elapsed;
+    int i;
+
+    for (i = 0; i < k; i++)
+    {
+        if (mode == LOCKED)
+        {
+            addEntry(pq, &initial[i]);
+        }
+        else
+        {
+            if (mode == RANKED)
+            {
+                record(initial[i], 1);
+            }
+            addMultiEntry(mq, &initial[i]);
+        }
+    }
+
+    start = now();
+    for (i = 0; i < threads; i++)
+    {
+        workers[i].seed = i + 1;
+        workers[i].ranks = workers[i].worst = 0;
+        if (pthread_create(&workers[i].thread, NULL, worker, &workers[i]) != 0)
+        {
+            perror("pthread_create");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (i = 0; i < threads; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+    elapsed = now() - start;
+
+    //* the entries belong to the workers, so they are removed before the queue is destroyed
+    for (i = 0; i < k; i++)
+    {
+        if (mode == LOCKED)
+        {
+            removeEntry(pq);
+        }
+        else if (removeMultiEntry(mq) == NULL)
+        {
+            fprintf(stderr, "mqbench: queue emptied early\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    return 2.0 * threads * workers[0].ops / elapsed;
+}
+
+/*
+ * Function: main
+ *
+ * Description: driver function for the benchmark, usage: mqbench [threads [ops [shards per thread [entries]]]]
+ *
+ * Big-O: O(n log n)
+*/
+
+int main(int argc, char *argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 4, ops = argc > 2 ? atoi(argv[2]) : 1000000;
+    int c = argc > 3 ? atoi(argv[3]) : 2, k = argc > 4 ? atoi(argv[4]) : 100000;
+    int i, *initial, worst = 0;
+    long ranks = 0;
+    double rate;
+    WORKER *workers;
+
+    if (threads < 1 || threads > MAX_THREADS || ops < 1 || c < 1 || k < 1 || argc > 5)
+    {
+        fprintf(stderr, "usage: mqbench [threads [ops [shards per thread [entries]]]]\n");
+        exit(EXIT_FAILURE);
+    }
+
+    initial = malloc(sizeof(int) * k);
+    workers = malloc(sizeof(WORKER) * threads);
+    tree = calloc(RANGE + 1, sizeof(int));
+    assert(initial != NULL && workers != NULL && tree != NULL);
+    srand(1);
+    for (i = 0; i < k; i++)
+    {
+        initial[i] = rand() % RANGE;
+    }
+    for (i = 0; i < threads; i++)
+    {
+        workers[i].ops = ops;
+        workers[i].keys = malloc(sizeof(int) * ops);
+        assert(workers[i].keys != NULL);
+    }
+
+    mode = LOCKED;
+    pq = createQueue(intcmp);
+    rate = run(workers, threads, initial, k);
+    printf("locked: %d threads, %.2f million operations per second\n", threads, rate / 1e6);
+    destroyQueue(pq);
+
+    mode = MULTI;
+    mq = createMultiQueue(c * threads, intcmp);
+    rate = run(workers, threads, initial, k);
+    printf("multi:  %d threads, %d shards, %.2f million operations per second\n", threads, c * threads, rate / 1e6);
+    destroyMultiQueue(mq);
+
+    mode = RANKED;
+    mq = createMultiQueue(c * threads, intcmp);
+    run(workers, threads, initial, k);
+    for (i = 0; i < threads; i++)
+    {
+        ranks += workers[i].ranks;
+        worst = workers[i].worst > worst ? workers[i].worst : worst;
+    }
+    printf("multi:  rank error mean %.2f, largest %d\n", (double) ranks / ((long) threads * ops), worst);
+    destroyMultiQueue(mq);
+
+    for (i = 0; i < threads; i++)
+    {
+        free(workers[i].keys);
+    }
+    free(workers);
+    free(initial);
+    free(tree);
+
+    return 0;
+}
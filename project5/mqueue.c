@@ -0,0 +1,214 @@
+/*
+ * File Name: mqueue.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines a MultiQueue, a priority queue that many threads can use at once without
+ *              waiting on a single lock. It is made of several shards, each a priority queue from pqueue.c
+ *              with its own lock and a copy of its first entry that can be read without the lock. An entry is
+ *              added to a random shard. To remove one, a thread looks at the first entries of two random
+ *              shards and removes from whichever is smaller. A thread that finds a shard locked tries two
+ *              others instead of waiting, so with a few shards per thread most attempts succeed right away.
+ *              The entry removed is usually among the smallest few times the number of shards, but not
+ *              always the smallest. Other threads may still compare an entry for a moment after it has been
+ *              removed, so an entry must not be changed or freed while the queue is in use. These functions
+ *              include pick, better, createMultiQueue, destroyMultiQueue, addMultiEntry, and removeMultiEntry.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "pqueue.h"
+#include "mqueue.h"
+
+#define LINE 64     //* cache line size, each shard is kept on its own line
+
+typedef struct shard
+{
+    _Alignas(LINE) pthread_mutex_t lock;
+    PQ *pq;
+    void *_Atomic top;      //* first entry of the queue, or NULL if it is empty, written under the lock
+}SHARD;
+
+typedef struct mqueue
+{
+    int count;
+    SHARD *shards;
+    int (*compare)();
+}MQ;
+
+static _Thread_local unsigned seed;     //* random state for choosing shards
+
+/* Function: pick
+ *
+ * Description: Returns a random shard number, starting each thread's random state from its own address
+ *
+ * Big-O: O(1)
+*/
+static int pick(MQ *mq)
+{
+    if (seed == 0)
+    {
+        seed = (unsigned) (uintptr_t) &seed | 1;
+    }
+
+    return rand_r(&seed) % mq -> count;
+}
+
+/* Function: better
+ *
+ * Description: Returns whichever of two shards has the smaller first entry, treating an empty shard as worse
+ *              than any other
+ *
+ * Big-O: O(1)
+*/
+static int better(MQ *mq, int i, void *first, int j, void *second)
+{
+    if (first == NULL)
+    {
+        return j;
+    }
+    if (second == NULL)
+    {
+        return i;
+    }
+
+    return (*mq -> compare)(second, first) < 0 ? j : i;
+}
+
+/* Function: createMultiQueue
+ *
+ * Description: Creates a new queue with the given number of shards, which should be a small multiple of the
+ *              number of threads that will use it
+ *
+ * Big-O: O(n)
+*/
+MQ *createMultiQueue(int shards, int (*compare)())
+{
+    assert(shards > 0 && compare != NULL);
+    MQ *mq = malloc(sizeof(MQ));
+    assert(mq != NULL);
+    mq -> count = shards;
+    mq -> compare = compare;
+    mq -> shards = aligned_alloc(LINE, sizeof(SHARD) * shards);
+    assert(mq -> shards != NULL);
+
+    int i;
+    for (i = 0; i < shards; i++)
+    {
+        pthread_mutex_init(&mq -> shards[i].lock, NULL);
+        mq -> shards[i].pq = createQueue(compare);
+        atomic_init(&mq -> shards[i].top, NULL);
+    }
+
+    return mq;
+}
+
+/* Function: destroyMultiQueue
+ *
+ * Description: Destroys a given queue, along with the entries still in it. No other thread may be using it.
+ *
+ * Big-O: O(n)
+*/
+void destroyMultiQueue(MQ *mq)
+{
+    assert(mq != NULL);
+    int i;
+    for (i = 0; i < mq -> count; i++)
+    {
+        pthread_mutex_destroy(&mq -> shards[i].lock);
+        destroyQueue(mq -> shards[i].pq);
+    }
+    free(mq -> shards);
+    free(mq);
+
+    return;
+}
+
+/* Function: addMultiEntry
+ *
+ * Description: Adds an entry to a random shard, trying another whenever the chosen one is locked
+ *
+ * Big-O: O(log n)
+*/
+void addMultiEntry(MQ *mq, void *entry)
+{
+    assert(mq != NULL && entry != NULL);
+    SHARD *sp;
+
+    do
+    {
+        sp = &mq -> shards[pick(mq)];
+    } while (pthread_mutex_trylock(&sp -> lock) != 0);
+
+    addEntry(sp -> pq, entry);
+    atomic_store_explicit(&sp -> top, peekEntry(sp -> pq), memory_order_release);
+    pthread_mutex_unlock(&sp -> lock);
+
+    return;
+}
+
+/* Function: removeMultiEntry
+ *
+ * Description: Removes the first entry of the better of two random shards and returns it. If both are empty,
+ *              every shard is checked, and NULL is returned if they all are, so the queue may seem empty while
+ *              another thread is in the middle of adding.
+ *
+ * Big-O: O(log n)
+*/
+void *removeMultiEntry(MQ *mq)
+{
+    assert(mq != NULL);
+    void *first, *second, *entry;
+    int i, j;
+    SHARD *sp;
+
+    while (1)
+    {
+        i = pick(mq);
+        j = pick(mq);
+        first = atomic_load_explicit(&mq -> shards[i].top, memory_order_acquire);
+        second = atomic_load_explicit(&mq -> shards[j].top, memory_order_acquire);
+
+        if (first == NULL && second == NULL)
+        {
+            for (i = 0; i < mq -> count; i++)
+            {
+                if (atomic_load_explicit(&mq -> shards[i].top, memory_order_acquire) != NULL)
+                {
+                    break;
+                }
+            }
+            if (i == mq -> count)
+            {
+                return NULL;
+            }
+            continue;
+        }
+
+        sp = &mq -> shards[better(mq, i, first, j, second)];
+        if (pthread_mutex_trylock(&sp -> lock) != 0)
+        {
+            continue;
+        }
+
+        //* the shard may have been emptied since its first entry was read
+        if (numEntries(sp -> pq) == 0)
+        {
+            pthread_mutex_unlock(&sp -> lock);
+            continue;
+        }
+
+        entry = removeEntry(sp -> pq);
+        atomic_store_explicit(&sp -> top, numEntries(sp -> pq) > 0 ? peekEntry(sp -> pq) : NULL,
+                              memory_order_release);
+        pthread_mutex_unlock(&sp -> lock);
+
+        return entry;
+    }
+}
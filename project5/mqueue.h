@@ -0,0 +1,24 @@
+/*
+ * File:	mqueue.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for a relaxed concurrent priority queue of
+ *		generic pointer types.  Any number of threads may add
+ *		and remove entries at once.  A removal returns one of the
+ *		smallest entries, but not always the very smallest.
+ */
+
+# ifndef MQUEUE_H
+# define MQUEUE_H
+
+typedef struct mqueue MQ;
+
+MQ *createMultiQueue(int shards, int (*compare)());
+
+void destroyMultiQueue(MQ *mq);
+
+void addMultiEntry(MQ *mq, void *entry);
+
+void *removeMultiEntry(MQ *mq);
+
+# endif /* MQUEUE_H */
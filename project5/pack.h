@@ -10,6 +10,7 @@
 struct node {
     struct node *parent;
     int count;
+    int order;				/* when the node was made, for ties */
 };
 
 void pack(char *infile, char *outfile, struct node *leaves[257]);
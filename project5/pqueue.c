@@ -7,27 +7,106 @@
  * 
  * Description: This file defines functions that modify an list of unknown types in a variety of 
  *              ways defined by sort.c. It uses a priority queue to do this. It contains a struct pqueue, 
- *              createQueue, destroyQueue, numEntries, addEntry, and removeEntry
+ *              allocData, siftDown, createQueue, createQueueFrom, reserveQueue, destroyQueue, numEntries,
+ *              addEntry, removeEntry, and peekEntry.
+ *              The heap is d-ary: each entry has ARITY children, four unless set when compiling. A wider heap
+ *              is shallower, so a removal makes fewer dependent steps down the tree, and the children of an
+ *              entry are kept together in one cache line, so comparing them costs about one miss.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "pqueue.h"
 
-#define INIT_LENGTH 10
-#define p(x) (((x) - 1) / 2)
-#define l(x) ((x) * 2 + 1)
-#define r(x) ((x) * 2 + 2)
+#define INIT_LENGTH 16   //* initial number of entries
+#define LINE 64          //* cache line size in bytes
+
+//* number of children of each entry, chosen when compiling, e.g. -DARITY=2 for a binary heap
+#ifndef ARITY
+#define ARITY 4
+#endif
+
+#define p(x) (((x) - 1) / ARITY)
+#define c(x) ((x) * ARITY + 1)
+
+//* the root is stored ARITY - 1 slots into the array, so the children of every entry start on a multiple of
+//* ARITY, and with the array aligned to a cache line each group of up to eight children shares one line
+#define OFFSET (ARITY - 1)
 
 typedef struct pqueue
 {
     int count;
     int length;
+    void **base;
     void **data;
     int (*compare)();
 }PQ;
 
+/* Function: allocData
+ *
+ * Description: Allocates room for the given number of entries, aligned to a cache line, and sets data to
+ *              the slot of the root
+ *
+ * Big-O: O(1)
+*/
+static void allocData(PQ *pq, int length)
+{
+    size_t size = sizeof(void*) * (length + OFFSET);
+    void **base = aligned_alloc(LINE, (size + LINE - 1) / LINE * LINE);
+    assert(base != NULL);
+
+    if (pq -> base != NULL)
+    {
+        memcpy(base + OFFSET, pq -> data, sizeof(void*) * pq -> count);
+        free(pq -> base);
+    }
+
+    pq -> base = base;
+    pq -> data = base + OFFSET;
+    pq -> length = length;
+
+    return;
+}
+
+/* Function: siftDown
+ *
+ * Description: Places an entry into the hole at the given slot, moving the smallest of the children up into
+ *              the hole while it is smaller than the entry
+ *
+ * Big-O: O(log n)
+*/
+static void siftDown(PQ *pq, int locate, void *entry)
+{
+    int smallest, child, end;
+
+    while (c(locate) < pq -> count)
+    {
+        //* find the smallest child, all of which share a cache line
+        smallest = c(locate);
+        end = smallest + ARITY < pq -> count ? smallest + ARITY : pq -> count;
+        for (child = smallest + 1; child < end; child++)
+        {
+            if ((*pq -> compare)(pq -> data[child], pq -> data[smallest]) < 0)
+            {
+                smallest = child;
+            }
+        }
+
+        if ((*pq -> compare)(entry, pq -> data[smallest]) <= 0)
+        {
+            break;
+        }
+
+        pq -> data[locate] = pq -> data[smallest];
+        locate = smallest;
+    }
+    pq -> data[locate] = entry;
+
+    return;
+}
+
 /* Function: createQueue
  * 
  * Description: Creates a new queue
@@ -39,15 +118,65 @@ PQ *createQueue(int (*compare)())
     PQ *pq = malloc(sizeof(PQ));
     assert(pq != NULL);
     pq -> count = 0;
-    pq -> length = INIT_LENGTH;
     assert(compare != NULL);
     pq -> compare = compare;
-    pq -> data = malloc(sizeof(void*) * INIT_LENGTH);
-    assert(pq -> data != NULL);
+    pq -> base = NULL;
+    allocData(pq, INIT_LENGTH);
 
     return pq;
 }
 
+/* Function: createQueueFrom
+ * 
+ * Description: Creates a new queue holding the given entries, which are copied into a single allocation and
+ *              then made into a heap from the bottom up: each parent, starting with the last, is sifted down
+ *              over children that are already heaps. Most entries are near the bottom and move only a level or
+ *              two, so this is linear rather than the O(n log n) of adding them one at a time.
+ * 
+ * Big-O: O(n)
+*/
+PQ *createQueueFrom(void **items, int n, int (*compare)())
+{
+    assert(n >= 0 && (items != NULL || n == 0));
+    PQ *pq = malloc(sizeof(PQ));
+    assert(pq != NULL);
+    assert(compare != NULL);
+    pq -> compare = compare;
+    pq -> count = 0;
+    pq -> base = NULL;
+    allocData(pq, n > INIT_LENGTH ? n : INIT_LENGTH);
+
+    memcpy(pq -> data, items, sizeof(void*) * n);
+    pq -> count = n;
+
+    int i;
+    for (i = n > 1 ? p(n - 1) : -1; i >= 0; i--)
+    {
+        siftDown(pq, i, pq -> data[i]);
+    }
+
+    return pq;
+}
+
+/* Function: reserveQueue
+ * 
+ * Description: Makes room for at least the given number of entries, so that adding up to that many does not
+ *              need to grow the queue
+ * 
+ * Big-O: O(n)
+*/
+void reserveQueue(PQ *pq, int n)
+{
+    assert(pq != NULL && n >= 0);
+
+    if (n > pq -> length)
+    {
+        allocData(pq, n);
+    }
+
+    return;
+}
+
 /* Function: destroyQueue
  * 
  * Description: Destroys a given queue
@@ -62,7 +191,7 @@ void destroyQueue(PQ *pq)
     {
         free(pq -> data[i]);
     }
-    free(pq -> data);
+    free(pq -> base);
     free(pq);
 
     return;
@@ -83,9 +212,10 @@ int numEntries(PQ *pq)
 
 /* Function: addEntry
  * 
- * Description: Creates a new entry in the queue
+ * Description: Creates a new entry in the queue. The parents larger than the entry move down into the hole
+ *              until the entry's place is found.
  * 
- * Big-O: O(n)
+ * Big-O: O(log n)
 */
 void addEntry(PQ *pq, void *entry)
 {
@@ -93,65 +223,48 @@ void addEntry(PQ *pq, void *entry)
 
     if (pq -> count == pq -> length)
     {
-        pq -> length *= 2;
-        pq -> data = realloc(pq -> data, sizeof(void*) * pq -> length);
-        assert(pq -> data != NULL);
+        allocData(pq, pq -> length * 2);
     }
-    
-    pq -> data[pq -> count] = entry;
 
     int locate = pq -> count;
-    while (pq -> count != 0 && (*pq -> compare)(pq -> data[p(locate)], pq -> data[locate]) > 0)
+    while (locate > 0 && (*pq -> compare)(pq -> data[p(locate)], entry) > 0)
     {
-        void *temp = pq -> data[locate];
         pq -> data[locate] = pq -> data[p(locate)];
-        pq -> data[p(locate)] = temp;
         locate = p(locate);
     }
+    pq -> data[locate] = entry;
     pq -> count++;
 
     return;
 }
 
-/* Function: addEntry
+/* Function: removeEntry
  * 
- * Description: Removes the first entry in the queue
+ * Description: Removes the first entry in the queue. The last entry is moved down from the root, and at each
+ *              level the smallest of the children moves up into the hole if it is smaller.
  * 
- * Big-O: O(n)
+ * Big-O: O(log n)
 */
 void *removeEntry(PQ *pq)
 {
-    assert(pq != NULL);
+    assert(pq != NULL && pq -> count > 0);
 
     void *start = pq -> data[0];
-    pq -> data[0] = pq -> data[pq -> count - 1];
-    int locate = 0; 
-    int smallest = 0;
-    while (l(locate) <= pq -> count - 1)
-    {
-        smallest = l(locate);
-        if (r(locate) <= pq -> count - 1)
-        {
-            if ((*pq -> compare)(pq -> data[r(locate)], pq -> data[l(locate)]) < 0)
-            {
-                smallest = r(locate);
-            }
-        }
-
-        if ((*pq -> compare)(pq -> data[locate], pq -> data[smallest]) < 0)
-        {
-            break;
-        }
-        else
-        {
-            void *temp = pq -> data[locate];
-            pq -> data[locate] = pq -> data[smallest];
-            pq -> data[smallest] = temp;
-            locate = smallest;
-        }
-        locate = smallest;
-    }
-    pq -> count--;
+    void *last = pq -> data[--pq -> count];
+    siftDown(pq, 0, last);
 
     return start;
 }
+
+/* Function: peekEntry
+ * 
+ * Description: Returns the first entry in the queue without removing it
+ * 
+ * Big-O: O(1)
+*/
+void *peekEntry(PQ *pq)
+{
+    assert(pq != NULL && pq -> count > 0);
+
+    return pq -> data[0];
+}
@@ -15,6 +15,10 @@ typedef struct pqueue PQ;
 
 PQ *createQueue(int (*compare)());
 
+PQ *createQueueFrom(void **items, int n, int (*compare)());
+
+void reserveQueue(PQ *pq, int n);
+
 void destroyQueue(PQ *pq);
 
 int numEntries(PQ *pq);
@@ -23,4 +27,6 @@ void addEntry(PQ *pq, void *entry);
 
 void *removeEntry(PQ *pq);
 
+void *peekEntry(PQ *pq);
+
 # endif /* PQUEUE_H */
@@ -0,0 +1,191 @@
+/*
+ * File Name: rheap.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines a radix heap, a priority queue for unsigned integer keys that are removed in
+ *              order that never decreases, as in a sort or a shortest path search. It remembers the last key
+ *              removed, and an entry goes into the bucket numbered by the highest bit in which its key differs
+ *              from that one, so bucket 0 holds the keys equal to it and bucket b the keys that agree with it
+ *              above bit b - 1. Removing takes from bucket 0. When bucket 0 is empty, the smallest key of the
+ *              first bucket that is not becomes the last key, and the entries of that bucket are spread into
+ *              lower buckets. An entry can only move down, so it moves at most 32 times, and no two entries are
+ *              ever compared except to find the smallest in a bucket. These functions include bucketOf,
+ *              append, createRadixHeap, destroyRadixHeap, numRadixEntries, addRadixEntry, and removeRadixEntry.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "rheap.h"
+
+#define INIT_LENGTH 16                          //* initial number of entries in a bucket
+#define BUCKETS (sizeof(unsigned) * 8 + 1)      //* one for the equal keys and one per bit
+
+typedef struct pair
+{
+    unsigned key;
+    void *entry;
+}PAIR;
+
+typedef struct bucket
+{
+    int count;
+    int length;
+    PAIR *pairs;
+}BUCKET;
+
+typedef struct rheap
+{
+    int count;
+    unsigned last;      //* last key removed
+    BUCKET buckets[BUCKETS];
+}RHEAP;
+
+/* Function: bucketOf
+ *
+ * Description: Returns the bucket for a key: 0 if it equals the last key removed, and otherwise one more than
+ *              the number of the highest bit in which they differ
+ *
+ * Big-O: O(1)
+*/
+static int bucketOf(RHEAP *rh, unsigned key)
+{
+    return key == rh -> last ? 0 : sizeof(unsigned) * 8 - __builtin_clz(key ^ rh -> last);
+}
+
+/* Function: append
+ *
+ * Description: Adds a key and its entry to the end of a bucket, doubling the bucket if it is full
+ *
+ * Big-O: O(1) amortized
+*/
+static void append(BUCKET *bp, unsigned key, void *entry)
+{
+    if (bp -> count == bp -> length)
+    {
+        bp -> length = bp -> length > 0 ? bp -> length * 2 : INIT_LENGTH;
+        bp -> pairs = realloc(bp -> pairs, sizeof(PAIR) * bp -> length);
+        assert(bp -> pairs != NULL);
+    }
+
+    bp -> pairs[bp -> count].key = key;
+    bp -> pairs[bp -> count].entry = entry;
+    bp -> count++;
+
+    return;
+}
+
+/* Function: createRadixHeap
+ *
+ * Description: Creates a new radix heap. The buckets are allocated when they are first used.
+ *
+ * Big-O: O(1)
+*/
+RHEAP *createRadixHeap(void)
+{
+    RHEAP *rh = calloc(1, sizeof(RHEAP));
+    assert(rh != NULL);
+
+    return rh;
+}
+
+/* Function: destroyRadixHeap
+ *
+ * Description: Destroys a given radix heap, along with the entries still in it
+ *
+ * Big-O: O(n)
+*/
+void destroyRadixHeap(RHEAP *rh)
+{
+    assert(rh != NULL);
+    int i, j;
+    for (i = 0; i < BUCKETS; i++)
+    {
+        for (j = 0; j < rh -> buckets[i].count; j++)
+        {
+            free(rh -> buckets[i].pairs[j].entry);
+        }
+        free(rh -> buckets[i].pairs);
+    }
+    free(rh);
+
+    return;
+}
+
+/* Function: numRadixEntries
+ *
+ * Description: Returns the number of entries in the radix heap
+ *
+ * Big-O: O(1)
+*/
+int numRadixEntries(RHEAP *rh)
+{
+    assert(rh != NULL);
+
+    return rh -> count;
+}
+
+/* Function: addRadixEntry
+ *
+ * Description: Adds an entry with the given key, which must not be smaller than the last key removed
+ *
+ * Big-O: O(1) amortized
+*/
+void addRadixEntry(RHEAP *rh, unsigned key, void *entry)
+{
+    assert(rh != NULL && entry != NULL && key >= rh -> last);
+
+    append(&rh -> buckets[bucketOf(rh, key)], key, entry);
+    rh -> count++;
+
+    return;
+}
+
+/* Function: removeRadixEntry
+ *
+ * Description: Removes an entry with the smallest key and returns it, storing its key if asked to. If no keys
+ *              equal the last key removed, the first bucket with entries is emptied into the lower ones.
+ *
+ * Big-O: O(log C) amortized, where C is the largest key
+*/
+void *removeRadixEntry(RHEAP *rh, unsigned *key)
+{
+    assert(rh != NULL && rh -> count > 0);
+    BUCKET *bp = &rh -> buckets[0];
+    int i, j;
+
+    if (bp -> count == 0)
+    {
+        //* find the first bucket with entries and the smallest key in it
+        for (i = 1; rh -> buckets[i].count == 0; i++);
+        bp = &rh -> buckets[i];
+        rh -> last = bp -> pairs[0].key;
+        for (j = 1; j < bp -> count; j++)
+        {
+            if (bp -> pairs[j].key < rh -> last)
+            {
+                rh -> last = bp -> pairs[j].key;
+            }
+        }
+
+        //* every entry in the bucket now agrees with the last key on bit i - 1, so it lands in a lower bucket
+        for (j = 0; j < bp -> count; j++)
+        {
+            append(&rh -> buckets[bucketOf(rh, bp -> pairs[j].key)], bp -> pairs[j].key, bp -> pairs[j].entry);
+        }
+        bp -> count = 0;
+        bp = &rh -> buckets[0];
+    }
+
+    rh -> count--;
+    bp -> count--;
+    if (key != NULL)
+    {
+        *key = bp -> pairs[bp -> count].key;
+    }
+
+    return bp -> pairs[bp -> count].entry;
+}
@@ -0,0 +1,26 @@
+/*
+ * File:	rheap.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for a radix heap, a priority queue of
+ *		generic pointer types ordered by unsigned integer keys.
+ *		The keys removed must never decrease: a key may not be
+ *		added that is smaller than the last key removed.
+ */
+
+# ifndef RHEAP_H
+# define RHEAP_H
+
+typedef struct rheap RHEAP;
+
+RHEAP *createRadixHeap(void);
+
+void destroyRadixHeap(RHEAP *rh);
+
+int numRadixEntries(RHEAP *rh);
+
+void addRadixEntry(RHEAP *rh, unsigned key, void *entry);
+
+void *removeRadixEntry(RHEAP *rh, unsigned *key);
+
+# endif /* RHEAP_H */
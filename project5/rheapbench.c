@@ -0,0 +1,176 @@
+/*
+ * File Name: rheapbench.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Measures the radix heap against the priority queue on integer keys. The sort workload adds n
+ *              random keys and then removes them all, as sort.c does. The search workload keeps k entries and
+ *              repeatedly removes the smallest and adds a new key a little larger than it, as a shortest path
+ *              search does. Both structures are checked to remove the same keys in the same order. It
+ *              contains intcmp, now, checksum, and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <time.h>
+#include "pqueue.h"
+#include "rheap.h"
+
+#define SPREAD 1024     //* largest step between a removed key and the key added after it
+
+/*
+ * Function: intcmp
+ *
+ * Description: compares two unsigned integers through pointers to them
+ *
+ * Big-O: O(1)
+*/
+
+static int intcmp(unsigned *i1, unsigned *i2)
+{
+    return (*i1 < *i2) ? -1 : (*i1 > *i2);
+}
+
+/*
+ * Function: now
+ *
+ * Description: returns the time in seconds
+ *
+ * Big-O: O(1)
+*/
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Function: checksum
+ *
+ * Description: mixes the next key removed into a running checksum that depends on the order of the keys
+ *
+ * Big-O: O(1)
+*/
+
+static unsigned long checksum(unsigned long sum, unsigned key)
+{
+    return sum * 31 + key;
+}
+
+/*
+ * Function: main
+ *
+ * Description: driver function for the benchmark, usage: rheapbench [n [k]]
+ *
+ * Big-O: O(n log n)
+*/
+
+int main(int argc, char *argv[])
+{
+    int i, n = argc > 1 ? atoi(argv[1]) : 1000000, k = argc > 2 ? atoi(argv[2]) : 1024;
+    unsigned *values, *steps, *p, key, last;
+    unsigned long heapSum, radixSum;
+    double start;
+    PQ *pq;
+    RHEAP *rh;
+
+    assert(n > 0 && k > 0 && k <= n);
+    values = malloc(sizeof(unsigned) * n);
+    steps = malloc(sizeof(unsigned) * n);
+    assert(values != NULL && steps != NULL);
+    srand(1);
+    for (i = 0; i < n; i++)
+    {
+        values[i] = (unsigned) rand() << 1 ^ rand();
+        steps[i] = rand() % SPREAD;
+    }
+
+    //* sort workload with the priority queue
+    pq = createQueue(intcmp);
+    start = now();
+    for (i = 0; i < n; i++)
+    {
+        addEntry(pq, &values[i]);
+    }
+    for (i = 0, heapSum = 0; i < n; i++)
+    {
+        p = removeEntry(pq);
+        heapSum = checksum(heapSum, *p);
+    }
+    printf("sort   n=%d: heap  %.3f s\n", n, now() - start);
+    destroyQueue(pq);
+
+    //* sort workload with the radix heap
+    rh = createRadixHeap();
+    start = now();
+    for (i = 0; i < n; i++)
+    {
+        addRadixEntry(rh, values[i], &values[i]);
+    }
+    for (i = 0, radixSum = 0, last = 0; i < n; i++)
+    {
+        removeRadixEntry(rh, &key);
+        assert(key >= last);
+        last = key;
+        radixSum = checksum(radixSum, key);
+    }
+    printf("sort   n=%d: radix %.3f s\n", n, now() - start);
+    destroyRadixHeap(rh);
+    assert(heapSum == radixSum);
+
+    //* search workload with the priority queue, where each new key is a step above the one removed
+    pq = createQueue(intcmp);
+    for (i = 0; i < k; i++)
+    {
+        values[i] = steps[i];
+        addEntry(pq, &values[i]);
+    }
+    start = now();
+    for (i = k, heapSum = 0; i < n; i++)
+    {
+        p = removeEntry(pq);
+        heapSum = checksum(heapSum, *p);
+        values[i] = *p + steps[i];
+        addEntry(pq, &values[i]);
+    }
+    printf("search k=%d: heap  %.3f s\n", k, now() - start);
+    while (numEntries(pq) > 0)
+    {
+        removeEntry(pq);
+    }
+    destroyQueue(pq);
+
+    //* search workload with the radix heap
+    rh = createRadixHeap();
+    for (i = 0; i < k; i++)
+    {
+        values[i] = steps[i];
+        addRadixEntry(rh, values[i], &values[i]);
+    }
+    start = now();
+    for (i = k, radixSum = 0; i < n; i++)
+    {
+        removeRadixEntry(rh, &key);
+        radixSum = checksum(radixSum, key);
+        values[i] = key + steps[i];
+        addRadixEntry(rh, values[i], &values[i]);
+    }
+    printf("search k=%d: radix %.3f s\n", k, now() - start);
+    while (numRadixEntries(rh) > 0)
+    {
+        removeRadixEntry(rh, NULL);
+    }
+    destroyRadixHeap(rh);
+    assert(heapSum == radixSum);
+
+    free(values);
+    free(steps);
+
+    return 0;
+}
@@ -6,25 +6,398 @@
  * Description:	Read in a sequence of integers from the standard input and
  *		write them in sorted order on the standard output.  The
  *		application works by inserting each integer into a priority
- *		queue ADT and then repeatedly removing the smallest value
- *		from the queue and printing it.
+ *		queue and then repeatedly removing the smallest value from
+ *		the queue and printing it.  The integers are read straight
+ *		into the array of the queue without being ordered, and the
+ *		queue is then built from all of them at once in linear
+ *		time, with no second copy of them.  The queues are
+ *		generated from theap.h for their key types, so the
+ *		integers are stored in the heap itself and the
+ *		comparisons are inlined.
+ *
+ *		With -m N, the integers are sorted using at most about N
+ *		megabytes of memory, so the input may be larger than the
+ *		memory of the machine.  The input is read a memory load
+ *		at a time, and each load is sorted and written to a
+ *		temporary file as a run, in the directory named by TMPDIR
+ *		or else /tmp.  The runs are then merged: a priority queue
+ *		holds one reader per run, ordered by the next integer in
+ *		each run, so removing the smallest reader gives the next
+ *		integer of the output.  If there are too many runs to
+ *		merge at once, groups of them are first merged into
+ *		longer runs.  All reads and writes of the
+ *		temporary files are large and sequential.  A run is
+ *		closed once it is written and opened again only while it
+ *		is being merged, so no more files are open at once than a
+ *		single merge needs, however large the input is.
  */
 
 # include <stdio.h>
 # include <stdlib.h>
+# include <string.h>
 # include <assert.h>
-# include "pqueue.h"
+# include <unistd.h>
+# include <sys/resource.h>
+# include "theap.h"
+# include "intio.h"
+
+# define MIN_BUFFER (64 * 1024)		/* smallest read buffer for a run */
+# define MAX_MERGE 256			/* most runs merged at once */
+# define INIT_SIZE 1024			/* initial length of the array */
+# define RESERVED_FILES 4		/* standard files and a merge output */
+
+struct run {
+    FILE *fp;				/* temporary file holding the run */
+    int *buffer;			/* block of the run read so far */
+    size_t size;			/* length of the buffer */
+    size_t count;			/* integers in the buffer */
+    size_t next;			/* next integer in the buffer */
+    int value;				/* current integer of the run */
+};
+
+
+DEFINE_HEAP(IntHeap, int, a < b)
+DEFINE_HEAP(RunHeap, struct run *, a->value < b->value)
+
+static char **names;			/* temporary files, NULL once removed */
+static int nnames, length;
+
+
+/*
+ * Function:	valuecmp
+ *
+ * Description:	Compare two integers in an array, for qsort.
+ */
+
+static int valuecmp(const void *p1, const void *p2)
+{
+    int i1 = *(int *) p1, i2 = *(int *) p2;
+
+    return (i1 < i2) ? -1 : (i1 > i2);
+}
+
+
+/*
+ * Function:	removeRuns
+ *
+ * Description:	Remove the temporary files that are left, when exiting.
+ */
+
+static void removeRuns(void)
+{
+    int i;
+
+
+    for (i = 0; i < nnames; i ++)
+	if (names[i] != NULL)
+	    unlink(names[i]);
+}
+
+
+/*
+ * Function:	createRun
+ *
+ * Description:	Create a new temporary file for a run in the directory
+ *		named by TMPDIR, or /tmp if it is not set, add its name to
+ *		the end of the names, and return it open for writing.
+ */
+
+static FILE *createRun(void)
+{
+    char *dir, *name;
+    FILE *fp;
+    int fd;
+
+
+    dir = getenv("TMPDIR");
+
+    if (dir == NULL || *dir == '\0')
+	dir = "/tmp";
+
+    name = malloc(strlen(dir) + sizeof("/sortXXXXXX"));
+    assert(name != NULL);
+    sprintf(name, "%s/sortXXXXXX", dir);
+
+    if ((fd = mkstemp(name)) == -1) {
+	perror("sort: temporary file");
+	exit(EXIT_FAILURE);
+    }
+
+    if (nnames == length) {
+	length = length > 0 ? length * 2 : 16;
+	names = realloc(names, sizeof(char *) * length);
+	assert(names != NULL);
+    }
+
+    names[nnames ++] = name;
+
+    if ((fp = fdopen(fd, "w")) == NULL) {
+	perror("sort: temporary file");
+	exit(EXIT_FAILURE);
+    }
+
+    return fp;
+}
+
+
+/*
+ * Function:	closeRun
+ *
+ * Description:	Close a run that has been written, checking that all of it
+ *		was written.
+ */
+
+static void closeRun(FILE *fp)
+{
+    if (fclose(fp) != 0) {
+	perror("sort: temporary file");
+	exit(EXIT_FAILURE);
+    }
+}
+
+
+/*
+ * Function:	openRun
+ *
+ * Description:	Open the run with the given number for reading and remove
+ *		its name, so the file goes away once it is closed.
+ */
+
+static FILE *openRun(int i)
+{
+    FILE *fp;
+
+
+    if ((fp = fopen(names[i], "r")) == NULL) {
+	perror("sort: temporary file");
+	exit(EXIT_FAILURE);
+    }
+
+    unlink(names[i]);
+    free(names[i]);
+    names[i] = NULL;
+    return fp;
+}
 
 
 /*
- * Function:	intcmp
+ * Function:	writeRun
  *
- * Description:	Given pointers to two integers, compare them as in strcmp.
+ * Description:	Sort an array of integers and write it to a new temporary
+ *		file as a run.
  */
 
-static int intcmp(int *i1, int *i2)
+static void writeRun(int *values, size_t n)
 {
-    return (*i1 < *i2) ? -1 : (*i1 > *i2);
+    FILE *fp;
+
+
+    qsort(values, n, sizeof(int), valuecmp);
+    fp = createRun();
+
+    if (fwrite(values, sizeof(int), n, fp) != n) {
+	perror("sort: temporary file");
+	exit(EXIT_FAILURE);
+    }
+
+    closeRun(fp);
+}
+
+
+/*
+ * Function:	advance
+ *
+ * Description:	Move a run to its next integer, reading another block of
+ *		the run if needed.  Return zero if the run is used up.  A
+ *		read error is fatal rather than the end of the run.
+ */
+
+static int advance(struct run *rp)
+{
+    if (rp->next == rp->count) {
+	rp->count = fread(rp->buffer, sizeof(int), rp->size, rp->fp);
+	rp->next = 0;
+
+	if (ferror(rp->fp)) {
+	    perror("sort: temporary file");
+	    exit(EXIT_FAILURE);
+	}
+
+	if (rp->count == 0)
+	    return 0;
+    }
+
+    rp->value = rp->buffer[rp->next ++];
+    return 1;
+}
+
+
+/*
+ * Function:	mergeRuns
+ *
+ * Description:	Merge the given number of runs starting with the given
+ *		one, which are removed.  The merged integers are written to
+ *		the given writer if it is not NULL, or to a new run
+ *		otherwise.  Each run gets an equal share of the memory
+ *		budget, as does the output file.
+ */
+
+static void mergeRuns(int first, int k, size_t budget, WRITER *wp)
+{
+    int i, *output;
+    RunHeap *hp;
+    struct run *runs, *rp;
+    size_t size, n;
+    FILE *out;
+
+
+    size = budget / (k + 1) / sizeof(int);
+    runs = malloc(sizeof(struct run) * k);
+    output = malloc(sizeof(int) * size);
+    assert(runs != NULL && output != NULL);
+    n = 0;
+
+
+    /* Start each run at its first integer. */
+
+    hp = createRunHeap();
+    out = wp == NULL ? createRun() : NULL;
+
+    for (i = 0; i < k; i ++) {
+	runs[i].fp = openRun(first + i);
+	runs[i].size = size;
+	runs[i].count = runs[i].next = 0;
+	runs[i].buffer = malloc(sizeof(int) * size);
+	assert(runs[i].buffer != NULL);
+
+	if (advance(&runs[i]))
+	    addRunHeap(hp, &runs[i]);
+    }
+
+
+    /* Repeatedly take the run with the smallest integer and advance it. */
+
+    while (numRunHeap(hp) > 0) {
+	rp = removeRunHeap(hp);
+
+	if (out == NULL)
+	    writeLong(wp, rp->value);
+	else {
+	    output[n ++] = rp->value;
+
+	    if (n == size) {
+		if (fwrite(output, sizeof(int), n, out) != n) {
+		    perror("sort: temporary file");
+		    exit(EXIT_FAILURE);
+		}
+
+		n = 0;
+	    }
+	}
+
+	if (advance(rp))
+	    addRunHeap(hp, rp);
+    }
+
+    for (i = 0; i < k; i ++) {
+	fclose(runs[i].fp);
+	free(runs[i].buffer);
+    }
+
+    if (out != NULL) {
+	if (fwrite(output, sizeof(int), n, out) != n) {
+	    perror("sort: temporary file");
+	    exit(EXIT_FAILURE);
+	}
+
+	closeRun(out);
+    }
+
+    destroyRunHeap(hp);
+    free(output);
+    free(runs);
+}
+
+
+/*
+ * Function:	externalSort
+ *
+ * Description:	Sort the integers read by the given reader into runs,
+ *		merge them, and write them to the given writer, using
+ *		about the given number of bytes of memory.
+ */
+
+static void externalSort(READER *rp, WRITER *wp, size_t budget)
+{
+    int *values, fanin, first;
+    size_t i, n, size;
+    struct rlimit limit;
+    long x;
+
+
+    /* Read a memory load at a time, writing each as a sorted run. */
+
+    size = budget / sizeof(int);
+    values = malloc(sizeof(int) * size);
+    assert(values != NULL);
+    atexit(removeRuns);
+    n = 0;
+
+    while (1) {
+	if (n == size || !readLong(rp, &x)) {
+	    if (n == 0)
+		break;
+
+	    if (nnames == 0 && n < size) {
+		qsort(values, n, sizeof(int), valuecmp);
+
+		for (i = 0; i < n; i ++)
+		    writeLong(wp, values[i]);
+
+		free(values);
+		return;
+	    }
+
+	    writeRun(values, n);
+
+	    if (n < size)
+		break;
+
+	    n = 0;
+	    continue;
+	}
+
+	values[n ++] = x;
+    }
+
+    free(values);
+
+
+    /* Merge groups of runs into longer runs until one merge is enough. */
+
+    fanin = budget / MIN_BUFFER - 1;
+
+    if (fanin > MAX_MERGE)
+	fanin = MAX_MERGE;
+
+    /* A merge has its runs and its output open, along with the
+       standard files, so it must fit within the limit on open files. */
+
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+	if (fanin > (long) limit.rlim_cur - RESERVED_FILES)
+	    fanin = (long) limit.rlim_cur - RESERVED_FILES;
+
+    if (fanin < 2)
+	fanin = 2;
+
+    for (first = 0; nnames - first > fanin; first += fanin)
+	mergeRuns(first, fanin, budget, NULL);
+
+    mergeRuns(first, nnames - first, budget, wp);
+
+    free(names);
+    names = NULL;
+    nnames = length = 0;
 }
 
 
@@ -34,28 +407,51 @@ static int intcmp(int *i1, int *i2)
  * Description:	Driver function for the sort application.
  */
 
-int main(void)
+int main(int argc, char *argv[])
 {
-    PQ *pq;
-    int *p, x;
-
+    IntHeap *hp;
+    int c, megabytes = 0, bad = 0;
+    long x;
+    READER *rp;
+    WRITER *wp;
 
-    pq = createQueue(intcmp);
 
-    while (scanf("%d", &x) == 1) {
-	p = malloc(sizeof(int));
-	assert(p != NULL);
+    while ((c = getopt(argc, argv, "m:")) != -1)
+	if (c == 'm' && (megabytes = atoi(optarg)) > 0)
+	    continue;
+	else
+	    bad = 1;
 
-	*p = x;
-	addEntry(pq, p);
+    if (optind != argc || bad) {
+	fprintf(stderr, "usage: sort [-m megabytes]\n");
+	exit(EXIT_FAILURE);
     }
 
-    while (numEntries(pq) > 0) {
-	p = removeEntry(pq);
-	printf("%d\n", *p);
-	free(p);
+    rp = createReader(0);
+    wp = createWriter(1);
+
+    if (megabytes > 0) {
+	externalSort(rp, wp, (size_t) megabytes << 20);
+	destroyReader(rp);
+	destroyWriter(wp);
+	exit(EXIT_SUCCESS);
     }
 
-    destroyQueue(pq);
+    /* Read in the integers, then make them into a queue all at once. */
+
+    hp = createIntHeap();
+    reserveIntHeap(hp, INIT_SIZE);
+
+    while (readLong(rp, &x))
+	appendIntHeap(hp, x);
+
+    destroyReader(rp);
+    heapifyIntHeap(hp);
+
+    while (numIntHeap(hp) > 0)
+	writeLong(wp, removeIntHeap(hp));
+
+    destroyWriter(wp);
+    destroyIntHeap(hp);
     exit(EXIT_SUCCESS);
 }
@@ -0,0 +1,205 @@
+/*
+ * File:	theap.h
+ *
+ * Description:	This file contains a macro that generates a priority
+ *		queue for one type of key.  The keys are stored in the
+ *		array of the heap itself rather than through pointers,
+ *		and the comparison is an expression given to the macro
+ *		rather than a function called through a pointer, so the
+ *		compiler can inline it.  For example,
+ *
+ *		    DEFINE_HEAP(IntHeap, int, a < b)
+ *
+ *		defines the type IntHeap and the functions createIntHeap,
+ *		createIntHeapFrom, destroyIntHeap, numIntHeap, addIntHeap,
+ *		removeIntHeap, peekIntHeap, reserveIntHeap, appendIntHeap,
+ *		and heapifyIntHeap.  The expression compares two keys
+ *		named a and b and is true if a comes first.
+ *
+ *		A large number of keys can be put straight into the array
+ *		of the heap with append, without ordering them, and then
+ *		ordered all at once in linear time with heapify.  Unlike
+ *		createFrom, this needs no second copy of the keys.
+ *
+ *		The heap is the same d-ary heap as pqueue.c: each entry
+ *		has four children, and the root is stored three slots in
+ *		so that with the array aligned to a cache line, a group of
+ *		children never straddles two lines for keys whose size is
+ *		a power of two up to 16 bytes.
+ */
+
+# ifndef THEAP_H
+# define THEAP_H
+
+# include <stdlib.h>
+# include <string.h>
+# include <assert.h>
+
+# define HEAP_ARITY 4			/* number of children of each entry */
+# define HEAP_LINE 64			/* cache line size in bytes */
+# define HEAP_OFFSET (HEAP_ARITY - 1)	/* slot of the root in the array */
+# define HEAP_INIT_LENGTH 16		/* initial number of entries */
+
+# define DEFINE_HEAP(name, type, less)					      \
+									      \
+typedef struct name {							      \
+    size_t count;							      \
+    size_t length;							      \
+    type *base;								      \
+    type *data;								      \
+} name;									      \
+									      \
+static inline int order##name(type a, type b)				      \
+{									      \
+    return (less);							      \
+}									      \
+									      \
+static inline void alloc##name(name *hp, size_t length)			      \
+{									      \
+    size_t size = sizeof(type) * (length + HEAP_OFFSET);		      \
+    type *base = aligned_alloc(HEAP_LINE,				      \
+	(size + HEAP_LINE - 1) / HEAP_LINE * HEAP_LINE);		      \
+    assert(base != NULL);						      \
+									      \
+    if (hp->base != NULL) {						      \
+	memcpy(base + HEAP_OFFSET, hp->data, sizeof(type) * hp->count);	      \
+	free(hp->base);							      \
+    }									      \
+									      \
+    hp->base = base;							      \
+    hp->data = base + HEAP_OFFSET;					      \
+    hp->length = length;						      \
+}									      \
+									      \
+static inline void siftDown##name(name *hp, size_t locate, type key)	      \
+{									      \
+    size_t smallest, child, end;					      \
+									      \
+    while (locate * HEAP_ARITY + 1 < hp->count) {			      \
+	smallest = locate * HEAP_ARITY + 1;				      \
+	end = smallest + HEAP_ARITY < hp->count ?			      \
+	    smallest + HEAP_ARITY : hp->count;				      \
+									      \
+	for (child = smallest + 1; child < end; child ++)		      \
+	    if (order##name(hp->data[child], hp->data[smallest]))	      \
+		smallest = child;					      \
+									      \
+	if (!order##name(hp->data[smallest], key))			      \
+	    break;							      \
+									      \
+	hp->data[locate] = hp->data[smallest];				      \
+	locate = smallest;						      \
+    }									      \
+									      \
+    hp->data[locate] = key;						      \
+}									      \
+									      \
+static inline name *create##name(void)					      \
+{									      \
+    name *hp = malloc(sizeof(name));					      \
+    assert(hp != NULL);							      \
+									      \
+    hp->count = 0;							      \
+    hp->base = NULL;							      \
+    alloc##name(hp, HEAP_INIT_LENGTH);					      \
+    return hp;								      \
+}									      \
+									      \
+static inline void heapify##name(name *hp)				      \
+{									      \
+    size_t i;								      \
+									      \
+    assert(hp != NULL);							      \
+									      \
+    if (hp->count > 1)							      \
+	for (i = (hp->count - 2) / HEAP_ARITY + 1; i -- > 0; )		      \
+	    siftDown##name(hp, i, hp->data[i]);				      \
+}									      \
+									      \
+static inline name *create##name##From(type *items, size_t n)		      \
+{									      \
+    name *hp;								      \
+									      \
+    assert(items != NULL || n == 0);					      \
+    hp = malloc(sizeof(name));						      \
+    assert(hp != NULL);							      \
+									      \
+    hp->count = 0;							      \
+    hp->base = NULL;							      \
+    alloc##name(hp, n > HEAP_INIT_LENGTH ? n : HEAP_INIT_LENGTH);	      \
+    memcpy(hp->data, items, sizeof(type) * n);				      \
+    hp->count = n;							      \
+    heapify##name(hp);							      \
+    return hp;								      \
+}									      \
+									      \
+static inline void destroy##name(name *hp)				      \
+{									      \
+    assert(hp != NULL);							      \
+    free(hp->base);							      \
+    free(hp);								      \
+}									      \
+									      \
+static inline size_t num##name(name *hp)				      \
+{									      \
+    assert(hp != NULL);							      \
+    return hp->count;							      \
+}									      \
+									      \
+static inline void add##name(name *hp, type key)			      \
+{									      \
+    size_t locate;							      \
+									      \
+    assert(hp != NULL);							      \
+									      \
+    if (hp->count == hp->length)					      \
+	alloc##name(hp, hp->length * 2);				      \
+									      \
+    locate = hp->count ++;						      \
+									      \
+    while (locate > 0 &&						      \
+	   order##name(key, hp->data[(locate - 1) / HEAP_ARITY])) {	      \
+	hp->data[locate] = hp->data[(locate - 1) / HEAP_ARITY];		      \
+	locate = (locate - 1) / HEAP_ARITY;				      \
+    }									      \
+									      \
+    hp->data[locate] = key;						      \
+}									      \
+									      \
+static inline type remove##name(name *hp)				      \
+{									      \
+    type first;								      \
+									      \
+    assert(hp != NULL && hp->count > 0);				      \
+									      \
+    first = hp->data[0];						      \
+    hp->count --;							      \
+    siftDown##name(hp, 0, hp->data[hp->count]);				      \
+    return first;							      \
+}									      \
+									      \
+static inline type peek##name(name *hp)					      \
+{									      \
+    assert(hp != NULL && hp->count > 0);				      \
+    return hp->data[0];							      \
+}									      \
+									      \
+static inline void reserve##name(name *hp, size_t length)		      \
+{									      \
+    assert(hp != NULL);							      \
+									      \
+    if (length > hp->length)						      \
+	alloc##name(hp, length);					      \
+}									      \
+									      \
+static inline void append##name(name *hp, type key)			      \
+{									      \
+    assert(hp != NULL);							      \
+									      \
+    if (hp->count == hp->length)					      \
+	alloc##name(hp, hp->length * 2);				      \
+									      \
+    hp->data[hp->count ++] = key;					      \
+}
+
+# endif /* THEAP_H */
@@ -11,69 +11,26 @@
  *              This implementation uses a hash table to store the
  *              elements, with linear probing to resolve collisions.
  *              Insertion, deletion, and membership checks are all average
- *              case constant time.
+ *              case constant time.  The table itself is generated from
+ *              tset.h for pointer elements, with the hash and comparison
+ *              functions of the set called through its aux pointer.
  */
 
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
 # include <assert.h>
-# include <stdbool.h>
 # include "set.h"
-
-# define EMPTY   0
-# define FILLED  1
-# define DELETED 2
+# include "tset.h"
 
 struct set {
-    int count;                  /* number of elements in array */
-    int length;                 /* length of allocated array   */
-    void **data;                /* array of allocated elements */
-    char *flags;                /* state of each slot in array */
+    struct Table *table;	/* hash table of the elements  */
     int (*compare)();		/* comparison function         */
     unsigned (*hash)();		/* hash function               */
 };
 
-/*
- * Function:    search
- *
- * Complexity:  O(1) average case, O(n) worst case
- *
- * Description: Return the location of ELT in the set pointed to by SP.  If
- *		the element is present, then *FOUND is true.  If not
- *		present, then *FOUND is false.  The element is first hashed
- *		to its correct location.  Linear probing is used to examine
- *		subsequent locations.
- */
-
-static int search(SET *sp, void *elt, bool *found)
-{
-    int available, i, locn, start;
-
-
-    available = -1;
-    start = (*sp->hash)(elt) % sp->length;
-
-    for (i = 0; i < sp->length; i ++) {
-        locn = (start + i) % sp->length;
-
-        if (sp->flags[locn] == EMPTY) {
-            *found = false;
-            return available != -1 ? available : locn;
-
-        } else if (sp->flags[locn] == DELETED) {
-            if (available == -1)
-		available = locn;
-
-        } else if ((*sp->compare)(sp->data[locn], elt) == 0) {
-            *found = true;
-            return locn;
-        }
-    }
-
-    *found = false;
-    return available;
-}
+DEFINE_SET(Table, void *, (*((SET *) aux)->hash)(k),
+	(*((SET *) aux)->compare)(a, b) == 0)
 
 
 /*
@@ -87,7 +44,6 @@ static int search(SET *sp, void *elt, bool *found)
 
 SET *createSet(int maxElts, int (*compare)(), unsigned (*hash)())
 {
-    int i;
     SET *sp;
 
 
@@ -96,20 +52,9 @@ SET *createSet(int maxElts, int (*compare)(), unsigned (*hash)())
     sp = malloc(sizeof(SET));
     assert(sp != NULL);
 
-    sp->data = malloc(sizeof(char *) * maxElts);
-    assert(sp->data != NULL);
-
-    sp->flags = malloc(sizeof(char) * maxElts);
-    assert(sp->flags != NULL);
-
     sp->compare = compare;
     sp->hash = hash;
-    sp->length = maxElts;
-    sp->count = 0;
-
-    for (i = 0; i < maxElts; i ++)
-        sp->flags[i] = EMPTY;
-
+    sp->table = createTable(maxElts, sp);
     return sp;
 }
 
@@ -129,8 +74,7 @@ void destroySet(SET *sp)
 {
     assert(sp != NULL);
 
-    free(sp->flags);
-    free(sp->data);
+    destroyTable(sp->table);
     free(sp);
 }
 
@@ -146,7 +90,7 @@ void destroySet(SET *sp)
 int numElements(SET *sp)
 {
     assert(sp != NULL);
-    return sp->count;
+    return numTable(sp->table);
 }
 
 
@@ -160,20 +104,8 @@ int numElements(SET *sp)
 
 void addElement(SET *sp, void *elt)
 {
-    int locn;
-    bool found;
-
-
     assert(sp != NULL && elt != NULL);
-    locn = search(sp, elt, &found);
-
-    if (!found) {
-	assert(sp->count < sp->length);
-
-	sp->data[locn] = elt;
-	sp->flags[locn] = FILLED;
-	sp->count ++;
-    }
+    addTable(sp->table, elt);
 }
 
 
@@ -188,17 +120,8 @@ void addElement(SET *sp, void *elt)
 
 void removeElement(SET *sp, void *elt)
 {
-    int locn;
-    bool found;
-
-
     assert(sp != NULL && elt != NULL);
-    locn = search(sp, elt, &found);
-
-    if (found) {
-	sp->flags[locn] = DELETED;
-	sp->count --;
-    }
+    removeTable(sp->table, elt);
 }
 
 
@@ -213,14 +136,13 @@ void removeElement(SET *sp, void *elt)
 
 void *findElement(SET *sp, void *elt)
 {
-    int locn;
-    bool found;
+    void **slot;
 
 
     assert(sp != NULL && elt != NULL);
 
-    locn = search(sp, elt, &found);
-    return found ? sp->data[locn] : NULL;
+    slot = findTable(sp->table, elt);
+    return slot != NULL ? *slot : NULL;
 }
 
 /* Function: partition
@@ -282,24 +204,13 @@ static void quickSort(int lo, int hi, int (*compare)(), void* elts[])
 
 void *getElements(SET *sp)
 {
-    int i, j;
     void **elts;
 
 
     assert(sp != NULL);
 
-    elts = malloc(sizeof(void *) * sp->count);
-    assert(elts != NULL);
-
-    for (i = 0, j = 0; i < sp->length; i++)
-    {
-	    if (sp->flags[i] == FILLED)
-        {
-	        elts[j++] = sp->data[i];
-        }
-    }
-
-    quickSort(0, j - 1, sp -> compare, elts); 
+    elts = elementsTable(sp->table);
+    quickSort(0, numTable(sp->table) - 1, sp -> compare, elts); 
 
     return elts;
 }
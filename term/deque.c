@@ -0,0 +1,258 @@
+/*
+ * File Name: deque.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines a work-stealing deque following Chase and Lev, using the C11 memory orderings
+ *              from Le, Pop, Cohen, and Zappa Nardelli. The items sit in a circular array between top and
+ *              bottom. The owner adds and removes at bottom without any compare and swap, except when it
+ *              races a thief for the very last item. Thieves take from top and claim an item with a compare
+ *              and swap on top. When the array fills, the owner copies the items into an array twice as long.
+ *              A thief may still be reading the old array, so old arrays are kept until the deque is destroyed.
+ *              These functions include createArray, grow, createDeque, destroyDeque, numItemsDeque,
+ *              addLastDeque, removeLastDeque, and stealFirstDeque.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "deque.h"
+
+#define INIT_LENGTH 64      //* initial length of the array, must be a power of two
+#define LINE 64             //* cache line size, top and bottom are kept on separate lines
+
+typedef struct array
+{
+    long mask;                  //* length of the array minus one
+    struct array* prev;         //* array this one replaced, freed with the deque
+    _Atomic(void*) slots[];     //* items, indexed by position & mask
+}ARRAY;
+
+struct deque
+{
+    _Atomic(ARRAY*) array;              //* current array
+    _Alignas(LINE) atomic_long top;     //* position of the first item, advanced by thieves and the owner
+    _Alignas(LINE) atomic_long bottom;  //* position after the last item, written only by the owner
+    char pad[LINE - sizeof(atomic_long)];
+};
+
+/*
+ * Function: createArray
+ *
+ * Description: allocates an empty array of the given length
+ *
+ * Big-O: O(1)
+*/
+
+static ARRAY *createArray(long length)
+{
+    ARRAY *ap = malloc(sizeof(ARRAY) + sizeof(_Atomic(void*)) * length);
+    assert(ap != NULL);
+    ap -> mask = length - 1;
+    ap -> prev = NULL;
+
+    return ap;
+}
+
+/*
+ * Function: grow
+ *
+ * Description: copies the items between top and bottom into an array twice as long and publishes it, called
+ *              only by the owner
+ *
+ * Big-O: O(n)
+*/
+
+static ARRAY *grow(DEQUE *dp, ARRAY *old, long top, long bottom)
+{
+    long i;
+    ARRAY *ap = createArray(2 * (old -> mask + 1));
+    ap -> prev = old;
+
+    for (i = top; i < bottom; i++)
+    {
+        atomic_store_explicit(&ap -> slots[i & ap -> mask],
+                              atomic_load_explicit(&old -> slots[i & old -> mask], memory_order_relaxed),
+                              memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&dp -> array, ap, memory_order_release);
+
+    return ap;
+}
+
+/*
+ * Function: createDeque
+ *
+ * Description: creates an empty deque
+ *
+ * Big-O: O(1)
+*/
+
+DEQUE *createDeque(void)
+{
+    DEQUE *dp = aligned_alloc(LINE, sizeof(DEQUE));
+    assert(dp != NULL);
+    atomic_init(&dp -> array, createArray(INIT_LENGTH));
+    atomic_init(&dp -> top, 0);
+    atomic_init(&dp -> bottom, 0);
+
+    return dp;
+}
+
+/*
+ * Function: destroyDeque
+ *
+ * Description: destroys a given deque and every array it has used, but not the items still in it. No other
+ *              thread may be using the deque.
+ *
+ * Big-O: O(log n)
+*/
+
+void destroyDeque(DEQUE *dp)
+{
+    assert(dp != NULL);
+    ARRAY *ap = atomic_load(&dp -> array), *prev;
+
+    while (ap != NULL)
+    {
+        prev = ap -> prev;
+        free(ap);
+        ap = prev;
+    }
+
+    free(dp);
+
+    return;
+}
+
+/*
+ * Function: numItemsDeque
+ *
+ * Description: returns the number of items in the deque, which may already be out of date if other threads
+ *              are using it
+ *
+ * Big-O: O(1)
+*/
+
+int numItemsDeque(DEQUE *dp)
+{
+    assert(dp != NULL);
+    long top = atomic_load_explicit(&dp -> top, memory_order_acquire);
+    long bottom = atomic_load_explicit(&dp -> bottom, memory_order_acquire);
+
+    return bottom > top ? bottom - top : 0;
+}
+
+/*
+ * Function: addLastDeque
+ *
+ * Description: adds an item at the rear of the deque, called only by the owner
+ *
+ * Big-O: O(1) amortized
+*/
+
+void addLastDeque(DEQUE *dp, void *item)
+{
+    assert(dp != NULL && item != NULL);
+    long bottom = atomic_load_explicit(&dp -> bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&dp -> top, memory_order_acquire);
+    ARRAY *ap = atomic_load_explicit(&dp -> array, memory_order_relaxed);
+
+    if (bottom - top > ap -> mask)
+    {
+        ap = grow(dp, ap, top, bottom);
+    }
+
+    atomic_store_explicit(&ap -> slots[bottom & ap -> mask], item, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dp -> bottom, bottom + 1, memory_order_relaxed);
+
+    return;
+}
+
+/*
+ * Function: removeLastDeque
+ *
+ * Description: removes the item at the rear of the deque, called only by the owner. Returns NULL if the deque
+ *              is empty or a thief took the last item first.
+ *
+ * Big-O: O(1)
+*/
+
+void *removeLastDeque(DEQUE *dp)
+{
+    assert(dp != NULL);
+    long bottom = atomic_load_explicit(&dp -> bottom, memory_order_relaxed) - 1;
+    ARRAY *ap = atomic_load_explicit(&dp -> array, memory_order_relaxed);
+    void *item = NULL;
+    long top;
+
+    //* claim the last position before looking at top, so a thief cannot take it unnoticed
+    atomic_store_explicit(&dp -> bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    top = atomic_load_explicit(&dp -> top, memory_order_relaxed);
+
+    if (top <= bottom)
+    {
+        item = atomic_load_explicit(&ap -> slots[bottom & ap -> mask], memory_order_relaxed);
+
+        //* only one item was left, so race the thieves for it
+        if (top == bottom)
+        {
+            if (!atomic_compare_exchange_strong_explicit(&dp -> top, &top, top + 1, memory_order_seq_cst,
+                                                         memory_order_relaxed))
+            {
+                item = NULL;
+            }
+
+            atomic_store_explicit(&dp -> bottom, bottom + 1, memory_order_relaxed);
+        }
+    }
+    else
+    {
+        atomic_store_explicit(&dp -> bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    return item;
+}
+
+/*
+ * Function: stealFirstDeque
+ *
+ * Description: removes the item at the front of the deque, called by any thread other than the owner. Returns
+ *              NULL if the deque is empty or another thread took the item first.
+ *
+ * Big-O: O(1)
+*/
+
+void *stealFirstDeque(DEQUE *dp)
+{
+    assert(dp != NULL);
+    long top = atomic_load_explicit(&dp -> top, memory_order_acquire);
+    long bottom;
+    ARRAY *ap;
+    void *item;
+
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&dp -> bottom, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return NULL;
+    }
+
+    ap = atomic_load_explicit(&dp -> array, memory_order_acquire);
+    item = atomic_load_explicit(&ap -> slots[top & ap -> mask], memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&dp -> top, &top, top + 1, memory_order_seq_cst,
+                                                 memory_order_relaxed))
+    {
+        return NULL;
+    }
+
+    return item;
+}
@@ -0,0 +1,31 @@
+/*
+ * File:	deque.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for a work-stealing deque of generic pointer
+ *		types in the style of Chase and Lev.  One thread owns the
+ *		deque and adds and removes items at the rear without locks,
+ *		while any other thread may steal items from the front.  The
+ *		deque grows as needed.  Removing or stealing returns NULL
+ *		if the deque is empty, and stealing also returns NULL if
+ *		another thread took the same item first.
+ */
+
+# ifndef DEQUE_H
+# define DEQUE_H
+
+typedef struct deque DEQUE;
+
+extern DEQUE *createDeque(void);
+
+extern void destroyDeque(DEQUE *dp);
+
+extern int numItemsDeque(DEQUE *dp);
+
+extern void addLastDeque(DEQUE *dp, void *item);
+
+extern void *removeLastDeque(DEQUE *dp);
+
+extern void *stealFirstDeque(DEQUE *dp);
+
+# endif /* DEQUE_H */
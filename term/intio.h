@@ -0,0 +1,31 @@
+/*
+ * File:	intio.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for reading and writing integers in bulk.  A
+ *		READER reads a file a large block at a time and parses
+ *		the integers in it, which are separated by white space.
+ *		A WRITER formats integers one per line into a large block
+ *		and writes the block out when it fills or is closed.
+ */
+
+# ifndef INTIO_H
+# define INTIO_H
+
+typedef struct reader READER;
+
+typedef struct writer WRITER;
+
+extern READER *createReader(int fd);
+
+extern void destroyReader(READER *rp);
+
+extern int readLong(READER *rp, long *x);
+
+extern WRITER *createWriter(int fd);
+
+extern void destroyWriter(WRITER *wp);
+
+extern void writeLong(WRITER *wp, long x);
+
+# endif /* INTIO_H */
@@ -1,62 +1,385 @@
 /*
  * File Name: list.c
- * 
+ *
  * Author: Jake Esperson
- * 
+ *
  * Date: 03-15-2023
- * 
- * Description: This file defines functions that combines a linked list and array to implement stack and queue operations. 
- *              These functions include createNode, createList, destroyList, numItems, addFirst, addLast, removeFirst, removeLast,
- *              getItem, and setItem.
+ *
+ * Description: This file defines functions that combines a list of nodes and arrays to implement stack and queue operations.
+ *              These functions include createNode, freeNode, nodeAt, growDir, pushFront, pushBack, locate, copyOut, copyIn, mergeSort,
+ *              createList, destroyList, numItems, addFirst, addLast, removeFirst, removeLast, getFirst, getLast, getItem,
+ *              setItem, toArray, fromArray, sortList, and spliceList.
+ *              The nodes are kept in order in a directory, a circular array of node pointers that can grow at
+ *              either end. Each node remembers the position of its first item, counted from a fixed origin, so
+ *              getItem and setItem binary search the directory instead of walking the nodes from the front.
+ *              Node arrays double in length up to MAX_LENGTH and are always a power of two, so positions wrap
+ *              around with a mask. The last node to empty out is kept as a spare for the next node needed.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
 #include "list.h"
 
+#define INIT_LENGTH 16  //* length of the array in the first node, a power of two
+#define MAX_LENGTH 1024 //* longest array in any node, a power of two
+#define INIT_DIR 8      //* length of the directory, a power of two
+#define MIN_MERGE 16    //* runs this short are insertion sorted by mergeSort
+
 typedef struct node
 {
     void** data;       //* array for storing elements
-    struct node* next; //* next node
-    struct node* prev; //* previous node
     int length;        //* length of the array
     int count;         //* count of how many items are in the array
     int first;         //* first item in the array, not always 0 due to circular queue
+    long start;        //* position of the first item, counted from the same origin for every node
 }NODE;
 
 typedef struct list
 {
     int count;         //* count of number of nodes
-    struct node* head; //* sentinel node
     int total;         //* count of number of total elements across all nodes
+    NODE** dir;        //* directory of nodes in order, a circular array
+    int dirlen;        //* length of the directory, a power of two
+    int dirfirst;      //* index of the first node in the directory
+    struct node* spare; //* emptied node kept for reuse, or NULL
 }LIST;
 
-/* 
+/*
  * Function: createNode
- * 
- * Description: creates a node with an array of void elements
- * 
+ *
+ * Description: creates a node with an array of void elements, reusing the spare node if there is one
+ *
  * Big-O: O(1)
 */
 
-static NODE *createNode(int length)
+static NODE *createNode(LIST *lp, int length)
 {
-    NODE *np = malloc(sizeof(NODE));
-    assert(np != NULL);
-    np -> length = length;
+    NODE *np = lp -> spare;
+
+    if (np != NULL)
+    {
+        lp -> spare = NULL;
+    }
+    else
+    {
+        if (length > MAX_LENGTH)
+        {
+            length = MAX_LENGTH;
+        }
+
+        np = malloc(sizeof(NODE));
+        assert(np != NULL);
+        np -> length = length;
+        np -> data = malloc(sizeof(void*) * length);
+        assert(np -> data != NULL);
+    }
+
     np -> count = 0;
     np -> first = 0;
-    np -> data = malloc(sizeof(void*) * length);
+    np -> start = 0;
+
+    return np;
+}
+
+/*
+ * Function: freeNode
+ *
+ * Description: frees an empty node, or keeps it as the spare if it is longer than the current spare
+ *
+ * Big-O: O(1)
+*/
+
+static void freeNode(LIST *lp, NODE *np)
+{
+    NODE *pDel = np;
+
+    if (lp -> spare == NULL || lp -> spare -> length < np -> length)
+    {
+        pDel = lp -> spare;
+        lp -> spare = np;
+    }
+
+    if (pDel != NULL)
+    {
+        free(pDel -> data);
+        free(pDel);
+    }
+
+    return;
+}
+
+/*
+ * Function: nodeAt
+ *
+ * Description: returns the node at the given position in the directory
+ *
+ * Big-O: O(1)
+*/
+
+static NODE *nodeAt(LIST *lp, int i)
+{
+    return lp -> dir[(lp -> dirfirst + i) & (lp -> dirlen - 1)];
+}
+
+/*
+ * Function: growDir
+ *
+ * Description: doubles the directory until it can hold the given number of nodes, copying the nodes to the
+ *              front of the new array
+ *
+ * Big-O: O(1) amortized
+*/
+
+static void growDir(LIST *lp, int need)
+{
+    int i, length = lp -> dirlen;
+
+    if (need <= length)
+    {
+        return;
+    }
+
+    while (length < need)
+    {
+        length *= 2;
+    }
+
+    NODE **dir = malloc(sizeof(NODE*) * length);
+    assert(dir != NULL);
+    for (i = 0; i < lp -> count; i++)
+    {
+        dir[i] = nodeAt(lp, i);
+    }
+
+    free(lp -> dir);
+    lp -> dir = dir;
+    lp -> dirlen = length;
+    lp -> dirfirst = 0;
+
+    return;
+}
+
+/*
+ * Function: pushFront
+ *
+ * Description: creates an empty node in front of the first node
+ *
+ * Big-O: O(1) amortized
+*/
+
+static NODE *pushFront(LIST *lp)
+{
+    NODE *pNew;
+
+    if (lp -> count == 0)
+    {
+        pNew = createNode(lp, INIT_LENGTH);
+    }
+    else
+    {
+        //* addFirst moves the start back by one as it adds the first item
+        pNew = createNode(lp, nodeAt(lp, 0) -> length * 2);
+        pNew -> start = nodeAt(lp, 0) -> start;
+    }
+
+    growDir(lp, lp -> count + 1);
+    lp -> dirfirst = (lp -> dirfirst - 1) & (lp -> dirlen - 1);
+    lp -> dir[lp -> dirfirst] = pNew;
+    lp -> count++;
+
+    return pNew;
+}
+
+/*
+ * Function: pushBack
+ *
+ * Description: creates an empty node behind the last node
+ *
+ * Big-O: O(1) amortized
+*/
+
+static NODE *pushBack(LIST *lp)
+{
+    NODE *pNew, *pLast;
+
+    if (lp -> count == 0)
+    {
+        pNew = createNode(lp, INIT_LENGTH);
+    }
+    else
+    {
+        pLast = nodeAt(lp, lp -> count - 1);
+        pNew = createNode(lp, pLast -> length * 2);
+        pNew -> start = pLast -> start + pLast -> count;
+    }
+
+    growDir(lp, lp -> count + 1);
+    lp -> dir[(lp -> dirfirst + lp -> count) & (lp -> dirlen - 1)] = pNew;
+    lp -> count++;
+
+    return pNew;
+}
+
+/*
+ * Function: locate
+ *
+ * Description: finds the node holding the item at the given index and the slot of the item in its array.
+ *              The ends are checked first, since stacks and queues mostly look there.
+ *
+ * Big-O: O(log n)
+*/
+
+static NODE *locate(LIST *lp, int index, int *slot)
+{
+    assert(lp != NULL && index >= 0 && index < lp -> total);
+    NODE *np;
+    long pos = nodeAt(lp, 0) -> start + index;
+    int lo = 0, hi = lp -> count - 1, mid;
+
+    if (pos >= nodeAt(lp, hi) -> start)
+    {
+        lo = hi;
+    }
+    else if (pos < nodeAt(lp, 0) -> start + nodeAt(lp, 0) -> count)
+    {
+        hi = 0;
+    }
+
+    //* find the last node that starts at or before the position
+    while (lo < hi)
+    {
+        mid = (lo + hi + 1) / 2;
+        if (nodeAt(lp, mid) -> start <= pos)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    np = nodeAt(lp, lo);
+    *slot = (np -> first + (pos - np -> start)) & (np -> length - 1);
 
     return np;
 }
 
-/* 
+/*
+ * Function: copyOut
+ *
+ * Description: copies the items of a node in order into an array, using at most two copies since the
+ *              items may wrap around the end of the node's array
+ *
+ * Big-O: O(n)
+*/
+
+static void copyOut(NODE *np, void **items)
+{
+    int head = np -> length - np -> first;
+
+    if (head >= np -> count)
+    {
+        memcpy(items, np -> data + np -> first, sizeof(void*) * np -> count);
+    }
+    else
+    {
+        memcpy(items, np -> data + np -> first, sizeof(void*) * head);
+        memcpy(items + head, np -> data, sizeof(void*) * (np -> count - head));
+    }
+
+    return;
+}
+
+/*
+ * Function: copyIn
+ *
+ * Description: overwrites the items of a node in order from an array, the reverse of copyOut
+ *
+ * Big-O: O(n)
+*/
+
+static void copyIn(NODE *np, void **items)
+{
+    int head = np -> length - np -> first;
+
+    if (head >= np -> count)
+    {
+        memcpy(np -> data + np -> first, items, sizeof(void*) * np -> count);
+    }
+    else
+    {
+        memcpy(np -> data + np -> first, items, sizeof(void*) * head);
+        memcpy(np -> data, items + head, sizeof(void*) * (np -> count - head));
+    }
+
+    return;
+}
+
+/*
+ * Function: mergeSort
+ *
+ * Description: stable merge sort of an array of items, using a second array of the same length as scratch
+ *              space. Short runs are insertion sorted.
+ *
+ * Big-O: O(n log n)
+*/
+
+static void mergeSort(void **items, void **temp, int n, int (*compare)())
+{
+    int i, j, k, half;
+    void *item;
+
+    if (n <= MIN_MERGE)
+    {
+        for (i = 1; i < n; i++)
+        {
+            item = items[i];
+            for (j = i; j > 0 && (*compare)(items[j - 1], item) > 0; j--)
+            {
+                items[j] = items[j - 1];
+            }
+            items[j] = item;
+        }
+
+        return;
+    }
+
+    half = n / 2;
+    mergeSort(items, temp, half, compare);
+    mergeSort(items + half, temp, n - half, compare);
+
+    //* the halves are already in order, which is common for partly sorted input
+    if ((*compare)(items[half - 1], items[half]) <= 0)
+    {
+        return;
+    }
+
+    memcpy(temp, items, sizeof(void*) * half);
+    for (i = 0, j = half, k = 0; i < half && j < n; k++)
+    {
+        if ((*compare)(items[j], temp[i]) < 0)
+        {
+            items[k] = items[j++];
+        }
+        else
+        {
+            items[k] = temp[i++];
+        }
+    }
+
+    memcpy(items + k, temp + i, sizeof(void*) * (half - i));
+
+    return;
+}
+
+/*
  * Function: createList
- * 
- * Description: creates a circular linked list with nodes
- * 
+ *
+ * Description: creates an empty list with an empty directory
+ *
  * Big-O: O(1)
 */
 
@@ -64,46 +387,53 @@ LIST *createList(void)
 {
     LIST *lp = malloc(sizeof(LIST));
     assert(lp != NULL);
-    lp -> head = createNode(8);
     lp -> count = 0;
     lp -> total = 0;
-    lp -> head -> next = lp -> head;
-    lp -> head -> prev = lp -> head;
+    lp -> dirlen = INIT_DIR;
+    lp -> dirfirst = 0;
+    lp -> dir = malloc(sizeof(NODE*) * INIT_DIR);
+    assert(lp -> dir != NULL);
+    lp -> spare = NULL;
 
     return lp;
 }
 
-/* 
+/*
  * Function: destroyList
- * 
+ *
  * Description: destroys a given linked list
- * 
+ *
  * Big-O: O(n)
 */
 
 void destroyList(LIST *lp)
 {
     assert(lp != NULL);
-    NODE* pDel;
-    NODE* pPrev = lp -> head -> prev;
+    int i;
 
-    while (pDel != lp -> head)
+    for (i = 0; i < lp -> count; i++)
     {
-        pDel = pPrev;
-        pPrev = pDel -> prev;
-        free(pDel);
+        free(nodeAt(lp, i) -> data);
+        free(nodeAt(lp, i));
     }
 
+    if (lp -> spare != NULL)
+    {
+        free(lp -> spare -> data);
+        free(lp -> spare);
+    }
+
+    free(lp -> dir);
     free(lp);
 
     return;
 }
 
-/* 
+/*
  * Function: numItems
- * 
+ *
  * Description: returns the number of elements in the linked list
- * 
+ *
  * Big-O: O(1)
 */
 
@@ -114,242 +444,348 @@ int numItems(LIST *lp)
     return lp -> total;
 }
 
-/* 
+/*
  * Function: addFirst
- * 
+ *
  * Description: inserts an item into the first node or creates a new one if the node is full
- * 
+ *
  * Big-O: O(1)
 */
 
 void addFirst(LIST *lp, void *item)
 {
     assert(lp != NULL && item != NULL);
-    NODE* temp = lp -> head -> next;
 
-    //* if the list is empty or the first node is full, create a new node
-    if (lp -> count == 0 || temp -> count == temp -> length)
-    {
-        NODE* pNew = malloc(sizeof(NODE));
-        pNew = createNode(((temp -> next -> length) * 2));
-        pNew -> next = temp;
-        pNew -> prev = temp -> prev;
-        temp -> prev -> next = pNew;
-        temp -> prev = pNew;
-        lp -> count++;
-        pNew -> data[0] = item;
-        pNew -> count++;
-        lp -> total++;
+    NODE* temp;
 
-        return;
+    //* if the list is empty or the first node is full, create a new node
+    if (lp -> count == 0 || nodeAt(lp, 0) -> count == nodeAt(lp, 0) -> length)
+    {
+        temp = pushFront(lp);
+    }
+    else
+    {
+        temp = nodeAt(lp, 0);
     }
 
-    //* else add the item to the first node
-    temp -> first = (temp -> first - 1 + temp -> length) % temp -> length;
+    //* add the item to the first node
+    temp -> first = (temp -> first - 1) & (temp -> length - 1);
     temp -> data[temp -> first] = item;
     temp -> count++;
-    lp -> total++; 
+    temp -> start--;
+    lp -> total++;
 
     return;
 }
 
-/* 
+/*
  * Function: addlast
- * 
+ *
  * Description: inserts an item into the last node or creates a new one if the node is full
- * 
- * Big-O: O(n)
+ *
+ * Big-O: O(1)
 */
 
 void addLast(LIST *lp, void *item)
 {
     assert(lp != NULL && item != NULL);
-    NODE* temp = lp -> head -> prev;
 
-    //* if the list is empty, create a new node
-    if (lp -> count == 0)
-    {
-        NODE* pNew = malloc(sizeof(NODE));
-        pNew = createNode(((temp -> prev -> length) * 2));
-        pNew -> prev = temp -> prev;
-        pNew -> next = temp;
-        temp -> prev -> next = pNew;
-        temp -> prev = pNew;
-        lp -> count++;
-        pNew -> data[0] = item;
-        pNew -> count++;
-        lp -> total++;
-        return;
-    }
+    NODE* temp;
 
-    while(temp -> count == temp -> length)
+    //* if the list is empty or the last node is full, create a new node
+    if (lp -> count == 0 || nodeAt(lp, lp -> count - 1) -> count == nodeAt(lp, lp -> count - 1) -> length)
     {
-        temp = temp -> prev;
+        temp = pushBack(lp);
     }
-
-    //* if the last node is full, create a new node
-    if (temp == lp -> head)
+    else
     {
-        NODE* pNew = malloc(sizeof(NODE));
-        pNew = createNode(((temp -> prev -> length) * 2));
-        pNew -> prev = temp -> prev;
-        pNew -> next = temp;
-        temp -> prev -> next = pNew;
-        temp -> prev = pNew;
-        lp -> count++;
-        pNew -> data[0] = item;
-        pNew -> count++;
-        lp -> total++;
-        return;
+        temp = nodeAt(lp, lp -> count - 1);
     }
 
-    temp -> data[(temp -> first + temp -> count++) % temp -> length] = item;
+    temp -> data[(temp -> first + temp -> count++) & (temp -> length - 1)] = item;
     lp -> total++;
     return;
 }
 
-/* 
+/*
  * Function: removeFirst
- * 
+ *
  * Description: removes the first element in the node or deletes the node if it is empty
- * 
+ *
  * Big-O: O(1)
 */
 
 void *removeFirst(LIST *lp)
 {
-    assert(lp != NULL);
+    assert(lp != NULL && lp -> total > 0);
 
-    NODE* pDel = lp -> head -> next;
-    void* localData = pDel -> data[pDel -> first % pDel -> length];
+    NODE* pDel = nodeAt(lp, 0);
+    void* localData = pDel -> data[pDel -> first];
 
-    pDel -> first++;
-    pDel -> first = pDel -> first % pDel -> length;
+    pDel -> first = (pDel -> first + 1) & (pDel -> length - 1);
     pDel -> count--;
+    pDel -> start++;
     lp -> total--;
 
     if(pDel -> count == 0)
     {
-        pDel -> prev -> next = pDel -> next;
-        pDel -> next -> prev = pDel -> prev;
-        free(pDel);
+        lp -> dirfirst = (lp -> dirfirst + 1) & (lp -> dirlen - 1);
+        freeNode(lp, pDel);
         lp -> count--;
     }
 
     return localData;
 }
 
-/* 
+/*
  * Function: removeLast
- * 
+ *
  * Description: removes the last element in the node or deletes the node if it is empty
- * 
+ *
  * Big-O: O(1)
 */
 
 void *removeLast(LIST *lp)
 {
-    assert(lp != NULL);
+    assert(lp != NULL && lp -> total > 0);
 
-    NODE* pDel = lp -> head -> prev;
-    void* localData = pDel -> data[(pDel -> first + pDel -> count - 1) % pDel -> length];
+    NODE* pDel = nodeAt(lp, lp -> count - 1);
+    void* localData = pDel -> data[(pDel -> first + pDel -> count - 1) & (pDel -> length - 1)];
 
     lp -> total--;
     pDel -> count--;
 
     if(pDel -> count == 0)
     {
-        pDel -> next -> prev = pDel -> prev;
-        pDel -> prev -> next = pDel -> next;
-        free(pDel);
+        freeNode(lp, pDel);
         lp -> count--;
     }
 
     return localData;
 }
 
-/* 
+/*
  * Function: getFirst
- * 
+ *
  * Description: returns the first element in the node
- * 
+ *
  * Big-O: O(1)
 */
 
 void *getFirst(LIST *lp)
 {
-    assert(lp != NULL);
+    assert(lp != NULL && lp -> total > 0);
 
-    NODE* pGet = lp -> head -> next;
-    void* localData = pGet -> data[pGet -> first % pGet -> length];
+    NODE* pGet = nodeAt(lp, 0);
+    void* localData = pGet -> data[pGet -> first];
 
     return localData;
 }
 
-/* 
+/*
  * Function: getLast
- * 
+ *
  * Description: returns the last element in the node
- * 
+ *
  * Big-O: O(1)
 */
 
 void *getLast(LIST *lp)
 {
-    assert(lp != NULL && lp -> count > 0);
+    assert(lp != NULL && lp -> total > 0);
 
-    NODE* pGet = lp -> head -> prev;
-    void* localData = pGet -> data[(pGet -> first + pGet -> count - 1) % pGet -> length];
+    NODE* pGet = nodeAt(lp, lp -> count - 1);
+    void* localData = pGet -> data[(pGet -> first + pGet -> count - 1) & (pGet -> length - 1)];
 
     return localData;
 }
 
-/* 
+/*
  * Function: getItem
- * 
+ *
  * Description: returns the element at the index given
- * 
- * Big-O: O(n)
+ *
+ * Big-O: O(log n)
 */
 
 void *getItem(LIST *lp, int index)
+{
+    int slot;
+    NODE* pGet = locate(lp, index, &slot);
+
+    return pGet -> data[slot];
+}
+
+/*
+ * Function: setItem
+ *
+ * Description: sets the element in the index given to the item given
+ *
+ * Big-O: O(log n)
+*/
+
+void setItem(LIST *lp, int index, void *item)
+{
+    assert(item != NULL);
+    int slot;
+    NODE* pSet = locate(lp, index, &slot);
+
+    pSet -> data[slot] = item;
+
+    return;
+}
+
+/*
+ * Function: toArray
+ *
+ * Description: allocates an array holding every item of the list in order, copying a node at a time
+ *
+ * Big-O: O(n)
+*/
+
+void *toArray(LIST *lp)
 {
     assert(lp != NULL);
+    int i;
+    void **items = malloc(sizeof(void*) * (lp -> total > 0 ? lp -> total : 1));
+    assert(items != NULL);
+    void **next = items;
+
+    for (i = 0; i < lp -> count; i++)
+    {
+        copyOut(nodeAt(lp, i), next);
+        next += nodeAt(lp, i) -> count;
+    }
 
-    NODE* pGet = lp -> head -> next;
+    return items;
+}
 
-    while (pGet != lp -> head && pGet -> count <= index)
+/*
+ * Function: fromArray
+ *
+ * Description: adds every item of an array to the end of the list in order, filling a node at a time
+ *
+ * Big-O: O(n)
+*/
+
+void fromArray(LIST *lp, void **items, int n)
+{
+    assert(lp != NULL && (items != NULL || n == 0));
+    int slot, size;
+    NODE *np;
+
+    while (n > 0)
     {
-        index = index - pGet -> count;
-        pGet = pGet -> next;
+        if (lp -> count == 0 || nodeAt(lp, lp -> count - 1) -> count == nodeAt(lp, lp -> count - 1) -> length)
+        {
+            np = pushBack(lp);
+        }
+        else
+        {
+            np = nodeAt(lp, lp -> count - 1);
+        }
+
+        //* copy as much as fits before the end of the node's array, then go around again
+        slot = (np -> first + np -> count) & (np -> length - 1);
+        size = np -> length - np -> count;
+        if (size > np -> length - slot)
+        {
+            size = np -> length - slot;
+        }
+        if (size > n)
+        {
+            size = n;
+        }
+
+        memcpy(np -> data + slot, items, sizeof(void*) * size);
+        np -> count += size;
+        lp -> total += size;
+        items += size;
+        n -= size;
     }
 
-    void* localData = pGet -> data[(pGet -> first + index) % pGet -> length];
+    return;
+}
 
-    return localData;
+/*
+ * Function: sortList
+ *
+ * Description: sorts the items of the list in place. The items are copied out to an array, merge sorted
+ *              there, and copied back into the same nodes.
+ *
+ * Big-O: O(n log n)
+*/
+
+void sortList(LIST *lp, int (*compare)())
+{
+    assert(lp != NULL && compare != NULL);
+    int i;
+    void **items, **temp, **next;
+
+    if (lp -> total < 2)
+    {
+        return;
+    }
+
+    items = toArray(lp);
+    temp = malloc(sizeof(void*) * (lp -> total / 2));
+    assert(temp != NULL);
+
+    mergeSort(items, temp, lp -> total, compare);
+
+    for (i = 0, next = items; i < lp -> count; i++)
+    {
+        copyIn(nodeAt(lp, i), next);
+        next += nodeAt(lp, i) -> count;
+    }
+
+    free(temp);
+    free(items);
+
+    return;
 }
 
-/* 
- * Function: setItem
- * 
- * Description: sets the element in the index given to the item given
- * 
- * Big-O: O(n)
+/*
+ * Function: spliceList
+ *
+ * Description: moves every item of src onto the end of dst, leaving src empty. Whole nodes are moved from
+ *              one directory to the other, and their positions are shifted to follow the last item of dst.
+ *
+ * Big-O: O(m), m is the number of nodes in src
 */
 
-void setItem(LIST *lp, int index, void *item)
+void spliceList(LIST *dst, LIST *src)
 {
-    assert(lp != NULL && item != NULL);
+    assert(dst != NULL && src != NULL && dst != src);
+    int i;
+    long shift = 0;
+    NODE *np;
 
-    NODE* pSet = lp -> head -> next;
+    if (src -> count == 0)
+    {
+        return;
+    }
 
-    while(pSet != lp -> head && pSet -> count <= index)
+    if (dst -> count > 0)
     {
-        index = index - pSet -> count;
-        pSet = pSet -> next;
+        np = nodeAt(dst, dst -> count - 1);
+        shift = np -> start + np -> count - nodeAt(src, 0) -> start;
     }
 
-    pSet -> data[(pSet -> first + index) % pSet -> length] = item;
+    growDir(dst, dst -> count + src -> count);
+
+    for (i = 0; i < src -> count; i++)
+    {
+        np = nodeAt(src, i);
+        np -> start += shift;
+        dst -> dir[(dst -> dirfirst + dst -> count + i) & (dst -> dirlen - 1)] = np;
+    }
+
+    dst -> count += src -> count;
+    dst -> total += src -> total;
+    src -> count = 0;
+    src -> total = 0;
+    src -> dirfirst = 0;
 
     return;
-}
\ No newline at end of file
+}
@@ -37,4 +37,12 @@ extern void *getItem(LIST *lp, int index);
 
 extern void setItem(LIST *lp, int index, void *item);
 
+extern void *toArray(LIST *lp);
+
+extern void fromArray(LIST *lp, void **items, int n);
+
+extern void sortList(LIST *lp, int (*compare)());
+
+extern void spliceList(LIST *dst, LIST *src);
+
 # endif /* LIST_H */
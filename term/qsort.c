@@ -4,77 +4,261 @@
  * Copyright:	2020, Darren C. Atkinson
  *
  * Description:	Reads words from a text file whose name is given as the
- *		first and only command-line argument.  The words are stored
- *		in a list that is then sorted using quicksort, and the words
- *		are then displayed in sorted order.
+ *		last command-line argument.  The words are stored in a list
+ *		that is then sorted using sortList, and the words are then
+ *		displayed in sorted order.
+ *
+ *		With -j N, the words are instead sorted by N threads using
+ *		samplesort: a sorted random sample gives N - 1 splitters,
+ *		every thread classifies its share of the words into the N
+ *		buckets between the splitters, the words are scattered into
+ *		one array bucket by bucket, and each thread then sorts one
+ *		bucket.  The phases run on a task pool of N - 1 workers,
+ *		with the main thread taking part while it waits.  Equal
+ *		words always land in the same bucket, so the output is the
+ *		same as the serial sort.
  */
 
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <assert.h>
 # include "list.h"
+# include "task.h"
 
 
 # define MAX_WORD_LENGTH 30		/* maximum length of a single word */
+# define MAX_JOBS 256			/* maximum number of threads */
+# define OVERSAMPLE 64			/* sample size per bucket */
+
+struct job {
+    int id;				/* thread number */
+    char **words;			/* all words, in input order */
+    char **out;				/* all words, in bucket order */
+    int n;				/* number of words */
+    int jobs;				/* number of threads */
+    char **splitters;			/* jobs - 1 splitters, in order */
+    unsigned short *buckets;		/* bucket of each word */
+    int *counts;			/* words per thread and bucket */
+    int *offsets;			/* first output slot per thread and bucket */
+};
+
+struct phase {
+    void (*fn)(struct job *);		/* phase to run */
+    struct job *jobs;			/* one job per thread */
+};
 
 
 /*
- * Function:	partition
+ * Function:	compare
  *
- * Description:	Choose the first element in the sublist as the pivot and
- *		partition the sublist around the pivot.  Hoare's partition
- *		scheme is used: https://en.wikipedia.org/wiki/Quicksort.
+ * Description:	Compare two words through pointers to them, for qsort.
  */
 
-static int partition(LIST *lp, int lo, int hi)
+static int compare(const void *p1, const void *p2)
 {
-    int i, j;
-    char *temp, *x;
+    return strcmp(*(char *const *) p1, *(char *const *) p2);
+}
 
 
-    x = getItem(lp, lo);
-    i = lo - 1;
-    j = hi + 1;
+/*
+ * Function:	classify
+ *
+ * Description:	Return the bucket of a word: the number of splitters that
+ *		are less than or equal to it.
+ */
 
-    while (i < j) {
-	do
-	    j = j - 1;
-	while (strcmp(getItem(lp, j), x) > 0);
+static int classify(char *word, char **splitters, int nsplitters)
+{
+    int lo, hi, mid;
 
-	do
-	    i = i + 1;
-	while (strcmp(getItem(lp, i), x) < 0);
 
-	if (i < j) {
-	    temp = getItem(lp, i);
-	    setItem(lp, i, getItem(lp, j));
-	    setItem(lp, j, temp);
-	}
+    lo = 0;
+    hi = nsplitters;
+
+    while (lo < hi) {
+	mid = (lo + hi) / 2;
+
+	if (strcmp(splitters[mid], word) <= 0)
+	    lo = mid + 1;
+	else
+	    hi = mid;
     }
 
-    return j;
+    return lo;
+}
+
+
+/*
+ * Function:	count
+ *
+ * Description:	Classify this thread's share of the words and count how
+ *		many go into each bucket.
+ */
+
+static void count(struct job *jp)
+{
+    int i, lo, hi, *counts;
+
+
+    lo = (long) jp->n * jp->id / jp->jobs;
+    hi = (long) jp->n * (jp->id + 1) / jp->jobs;
+    counts = jp->counts + jp->id * jp->jobs;
+
+    for (i = lo; i < hi; i ++) {
+	jp->buckets[i] = classify(jp->words[i], jp->splitters, jp->jobs - 1);
+	counts[jp->buckets[i]] ++;
+    }
 }
 
 
 /*
- * Function:	quickSort
+ * Function:	scatter
  *
- * Description:	Recursively sort the given sublist using the quicksort
- *		sorting algorithm: partition the sublist around a pivot,
- *		recursively sort the lower half of the list, and finally
- *		recursively sort the upper half of the list.
+ * Description:	Move this thread's share of the words to their slots in
+ *		the output array, keeping their order within each bucket.
  */
 
-static void quickSort(LIST *lp, int lo, int hi)
+static void scatter(struct job *jp)
 {
+    int i, lo, hi, *offsets;
+
+
+    lo = (long) jp->n * jp->id / jp->jobs;
+    hi = (long) jp->n * (jp->id + 1) / jp->jobs;
+    offsets = jp->offsets + jp->id * jp->jobs;
+
+    for (i = lo; i < hi; i ++)
+	jp->out[offsets[jp->buckets[i]] ++] = jp->words[i];
+}
+
+
+/*
+ * Function:	sortBucket
+ *
+ * Description:	Sort the bucket whose number is this thread's number.
+ */
+
+static void sortBucket(struct job *jp)
+{
+    int lo, hi;
+
+
+    lo = jp->id == 0 ? 0 : jp->offsets[(jp->jobs - 1) * jp->jobs + jp->id - 1];
+    hi = jp->offsets[(jp->jobs - 1) * jp->jobs + jp->id];
+    qsort(jp->out + lo, hi - lo, sizeof(char *), compare);
+}
+
+
+/*
+ * Function:	runRange
+ *
+ * Description:	Run a phase of the sort for the threads in a range.
+ */
+
+static void runRange(void *arg, int lo, int hi)
+{
+    struct phase *pp = arg;
     int i;
 
 
-    if (hi > lo) {
-	i = partition(lp, lo, hi);
-	quickSort(lp, lo, i);
-	quickSort(lp, i + 1, hi);
+    for (i = lo; i < hi; i ++)
+	(*pp->fn)(&pp->jobs[i]);
+}
+
+
+/*
+ * Function:	run
+ *
+ * Description:	Run a phase of the sort for every thread on the pool and
+ *		wait for all of them to finish.
+ */
+
+static void run(POOL *pool, void (*fn)(struct job *), struct job *jobs, int n)
+{
+    struct phase phase;
+
+
+    phase.fn = fn;
+    phase.jobs = jobs;
+    parallelFor(pool, 0, n, 1, runRange, &phase);
+}
+
+
+/*
+ * Function:	sampleSort
+ *
+ * Description:	Sort an array of words using the given number of threads
+ *		and return a new array holding them in order.
+ */
+
+static char **sampleSort(POOL *pool, char **words, int n, int njobs)
+{
+    int i, b, t, total, nsample;
+    char **sample, **splitters, **out;
+    struct job jobs[MAX_JOBS];
+    unsigned short *buckets;
+    int *counts, *offsets;
+
+
+    /* Choose the splitters from a sorted random sample. */
+
+    nsample = njobs * OVERSAMPLE;
+    sample = malloc(sizeof(char *) * nsample);
+    splitters = malloc(sizeof(char *) * njobs);
+    assert(sample != NULL && splitters != NULL);
+    srand(1);
+
+    for (i = 0; i < nsample; i ++)
+	sample[i] = words[rand() % n];
+
+    qsort(sample, nsample, sizeof(char *), compare);
+
+    for (i = 0; i < njobs - 1; i ++)
+	splitters[i] = sample[(i + 1) * OVERSAMPLE];
+
+
+    /* Classify and count the words, then scatter them into buckets. */
+
+    out = malloc(sizeof(char *) * n);
+    buckets = malloc(sizeof(unsigned short) * n);
+    counts = calloc(njobs * njobs, sizeof(int));
+    offsets = malloc(sizeof(int) * njobs * njobs);
+    assert(out != NULL && buckets != NULL && counts != NULL && offsets != NULL);
+
+    for (t = 0; t < njobs; t ++) {
+	jobs[t].id = t;
+	jobs[t].words = words;
+	jobs[t].out = out;
+	jobs[t].n = n;
+	jobs[t].jobs = njobs;
+	jobs[t].splitters = splitters;
+	jobs[t].buckets = buckets;
+	jobs[t].counts = counts;
+	jobs[t].offsets = offsets;
     }
+
+    run(pool, count, jobs, njobs);
+
+    for (b = 0, total = 0; b < njobs; b ++)
+	for (t = 0; t < njobs; t ++) {
+	    offsets[t * njobs + b] = total;
+	    total += counts[t * njobs + b];
+	}
+
+    run(pool, scatter, jobs, njobs);
+
+
+    /* After scattering, the last thread's offsets mark the bucket ends. */
+
+    run(pool, sortBucket, jobs, njobs);
+
+    free(offsets);
+    free(counts);
+    free(buckets);
+    free(splitters);
+    free(sample);
+    return out;
 }
 
 
@@ -88,13 +272,21 @@ int main(int argc, char *argv[])
 {
     FILE *fp;
     LIST *words;
-    char word[MAX_WORD_LENGTH+1];
+    POOL *pool;
+    char word[MAX_WORD_LENGTH+1], **items, **sorted;
+    int i, n, jobs = 1;
 
 
-    /* Check the number of arguments and try to open the file. */
+    /* Check the arguments and try to open the file. */
+
+    if (argc == 4 && strcmp(argv[1], "-j") == 0) {
+	jobs = atoi(argv[2]);
+	argc -= 2;
+	argv += 2;
+    }
 
-    if (argc != 2) {
-	fprintf(stderr, "missing filename\n");
+    if (argc != 2 || jobs < 1 || jobs > MAX_JOBS) {
+	fprintf(stderr, "usage: qsort [-j jobs] filename\n");
 	exit(EXIT_FAILURE);
     }
 
@@ -118,10 +310,26 @@ int main(int argc, char *argv[])
 
     /* Sort the words in the list and print them out in sorted order. */
 
-    quickSort(words, 0, numItems(words) - 1);
+    n = numItems(words);
 
-    while (numItems(words) > 0)
-	printf("%s\n", (char *) removeFirst(words));
+    if (jobs > 1 && n > 0) {
+	pool = createPool(jobs - 1, 0);
+	items = toArray(words);
+	sorted = sampleSort(pool, items, n, jobs);
+
+	for (i = 0; i < n; i ++)
+	    printf("%s\n", sorted[i]);
+
+	free(sorted);
+	free(items);
+	destroyPool(pool);
+
+    } else {
+	sortList(words, strcmp);
+
+	while (numItems(words) > 0)
+	    printf("%s\n", (char *) removeFirst(words));
+    }
 
     destroyList(words);
     exit(EXIT_SUCCESS);
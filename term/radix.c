@@ -3,97 +3,208 @@
  *
  * Copyright:	2020, Darren C. Atkinson
  *
- * Description:	Read a sequence of non-negative integers from the
- *		standard input and sort then using radix sort.  Each
- *		integer in the list is dropped into a bucket by its least
- *		significant digit.  After all integers are placed in
- *		buckets, the buckets are copied back into the list and we
- *		repeat the process, but with the next most significant
- *		digit.  After all digits have been processed, the list is
- *		sorted!  Since the buckets need to preserve the order of
- *		insertion, we need to implement a queue.  A list provides
- *		this functionality for us.  The algorithm can be found at
+ * Description:	Read a sequence of integers from the standard input and
+ *		sort then using radix sort.  The integers are stored in
+ *		an array, and each pass is a counting sort on one byte of
+ *		every integer, starting with the least significant.  A
+ *		counting sort keeps equal digits in the order they were
+ *		in, so after all bytes have been processed, the array is
+ *		sorted!  Bytes that are the same in every integer are
+ *		skipped.  The algorithm can be found at
  *		wikipedia.org/wiki/Radix_sort.
+ *
+ *		This replaces the linked list buckets of the version in
+ *		project4, which is kept as it was to go with the list
+ *		there and still drains its buckets with spliceList.  The
+ *		spliceList of the unrolled list here is no longer used by
+ *		this program.
+ *
+ *		With -t, the values are read as int (the default), long,
+ *		float, or double.  Negative values and floating point
+ *		values have their bits changed before sorting so that
+ *		they sort as unsigned integers.
+ *
+ *		With -j N, int and float values are sorted by N threads,
+ *		each of which counts and moves its own slice of the array
+ *		on every pass.  The output is the same as with one thread.
  */
 
-# include <math.h>
 # include <stdio.h>
 # include <stdlib.h>
+# include <string.h>
 # include <assert.h>
-# include "list.h"
+# include <unistd.h>
+# include "rsort.h"
+# include "task.h"
+# include "intio.h"
+
+# define INIT_SIZE 1024		/* initial length of the array */
+# define MAX_JOBS 256			/* maximum number of threads */
+
+enum { INT, LONG, FLOAT, DOUBLE };
 
-# define r 10
+static char *types[] = {"int", "long", "float", "double"};
+static size_t sizes[] = {sizeof(int32_t), sizeof(int64_t), sizeof(float), sizeof(double)};
 
 
 /*
- * Function:	main
+ * Function:	readValue
  *
- * Description:	Driver function for the radix application.
+ * Description:	Read one value of the given type into the given slot and
+ *		return whether one was read.  Integers are parsed by the
+ *		reader, and floating point values by scanf.
  */
 
-int main(void)
+static int readValue(READER *rp, int type, void *slot)
 {
-    int i, x, niter, div, max, *p;
-    LIST *a, *lists[r];
+    long l;
 
 
-    max = 0;
-    a = createList();
+    switch (type) {
+    case INT:
+	if (!readLong(rp, &l))
+	    return 0;
 
-    for (i = 0; i < r; i ++)
-	lists[i] = createList();
+	*(int32_t *) slot = l;
+	return 1;
 
+    case LONG:
+	if (!readLong(rp, &l))
+	    return 0;
 
-    /* Read in the numbers and record the maximum as we go along. */
+	*(int64_t *) slot = l;
+	return 1;
 
-    while (scanf("%d", &x) == 1) {
-	if (x >= 0) {
-	    p = malloc(sizeof(int));
-	    assert(p != NULL);
-	    *p = x;
+    case FLOAT:
+	return scanf("%f", (float *) slot) == 1;
+
+    default:
+	return scanf("%lf", (double *) slot) == 1;
+    }
+}
 
-	    addLast(a, p);
 
-	    if (x > max)
-		max = x;
+/*
+ * Function:	printValue
+ *
+ * Description:	Print one value of the given type, with enough digits
+ *		that it reads back as the same value.  Integers are
+ *		formatted by the writer, and floating point values by
+ *		printf.
+ */
 
-	} else {
-	    fprintf(stderr, "Sorry, only non-negative values allowed.\n");
-	    exit(EXIT_FAILURE);
-	}
+static void printValue(WRITER *wp, int type, void *slot)
+{
+    switch (type) {
+    case INT:
+	writeLong(wp, *(int32_t *) slot);
+	break;
+
+    case LONG:
+	writeLong(wp, *(int64_t *) slot);
+	break;
+
+    case FLOAT:
+	printf("%.9g\n", *(float *) slot);
+	break;
+
+    default:
+	printf("%.17g\n", *(double *) slot);
+	break;
     }
+}
 
-    div = 1;
-    niter = ceil(log(max + 1) / log(r));
 
-    while (niter --) {
+/*
+ * Function:	main
+ *
+ * Description:	Driver function for the radix application.
+ */
 
+int main(int argc, char *argv[])
+{
+    int c, type = INT, jobs = 1;
+    size_t i, n, size;
+    char *a;
+    POOL *pool = NULL;
+    READER *rp = NULL;
+    WRITER *wp = NULL;
+
+
+    /* Check the arguments. */
+
+    while ((c = getopt(argc, argv, "j:t:")) != -1)
+	if (c == 'j')
+	    jobs = atoi(optarg);
+	else if (c == 't') {
+	    for (type = 0; type <= DOUBLE; type ++)
+		if (strcmp(optarg, types[type]) == 0)
+		    break;
+	} else
+	    type = -1;
+
+    if (optind != argc || type < 0 || type > DOUBLE || jobs < 1 || jobs > MAX_JOBS) {
+	fprintf(stderr, "usage: radix [-j jobs] [-t int|long|float|double]\n");
+	exit(EXIT_FAILURE);
+    }
 
-	/* Move the numbers from the list to the buckets. */
+    n = 0;
+    size = INIT_SIZE;
+    a = malloc(sizes[type] * size);
+    assert(a != NULL);
 
-	while (numItems(a) > 0) {
-	    p = removeFirst(a);
-	    addLast(lists[*p / div % r], p);
-	}
 
+    /* Read in the values, doubling the array as it fills. */
+
+    if (type == INT || type == LONG)
+	rp = createReader(0);
 
-	/* Move the numbers from the buckets back into the list. */
+    while (1) {
+	if (n == size) {
+	    size *= 2;
+	    a = realloc(a, sizes[type] * size);
+	    assert(a != NULL);
+	}
 
-	for (i = 0; i < r; i ++)
-	    while (numItems(lists[i]) > 0)
-		addLast(a, removeFirst(lists[i]));
+	if (!readValue(rp, type, a + sizes[type] * n))
+	    break;
 
-	div = div * r;
+	n ++;
     }
 
+    if (rp != NULL)
+	destroyReader(rp);
 
-    /* Print out the numbers. */
 
-    while (numItems(a) > 0) {
-	p = removeFirst(a);
-	printf("%d\n", *p);
-	free(p);
-    }
+    /* Sort the values, using a pool of threads if asked to. */
+
+    if (jobs > 1 && (type == INT || type == FLOAT))
+	pool = createPool(jobs - 1, 0);
+
+    if (type == INT)
+	radixSortInt32(pool, (int32_t *) a, n);
+    else if (type == LONG)
+	radixSortInt64((int64_t *) a, n);
+    else if (type == FLOAT)
+	radixSortFloat(pool, (float *) a, n);
+    else
+	radixSortDouble((double *) a, n);
+
+    if (pool != NULL)
+	destroyPool(pool);
+
+
+    /* Print out the values. */
+
+    if (type == INT || type == LONG)
+	wp = createWriter(1);
+
+    for (i = 0; i < n; i ++)
+	printValue(wp, type, a + sizes[type] * i);
+
+    if (wp != NULL)
+	destroyWriter(wp);
 
+    free(a);
     exit(EXIT_SUCCESS);
 }
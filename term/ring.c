@@ -0,0 +1,313 @@
+/*
+ * File Name: ring.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines two bounded queues that threads can share without a lock. The RING allows any
+ *              number of producers and consumers and follows Dmitry Vyukov's design: every slot has a sequence
+ *              number that says whether it is ready to be written or read for a given lap around the array, so
+ *              producers and consumers only compete over their own counter with one compare and swap. The SPSC
+ *              allows a single producer and a single consumer, so neither needs a compare and swap, and each
+ *              keeps a cached copy of the other's counter to avoid reading a shared cache line on every call.
+ *              These functions include roundUp, createRing, destroyRing, addLastRing, removeFirstRing,
+ *              createSpsc, destroySpsc, addLastSpsc, and removeFirstSpsc.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "ring.h"
+
+#define LINE 64     //* cache line size, counters written by different threads are kept on separate lines
+
+typedef struct cell
+{
+    atomic_size_t seq;  //* lap and position this slot is ready for
+    void* data;         //* item stored in the slot
+}CELL;
+
+struct ring
+{
+    CELL* cells;                                //* array of slots
+    size_t mask;                                //* length of the array minus one, the length is a power of two
+    _Alignas(LINE) atomic_size_t tail;          //* position of the next add
+    _Alignas(LINE) atomic_size_t head;          //* position of the next remove
+    char pad[LINE - sizeof(atomic_size_t)];
+};
+
+struct spsc
+{
+    void** data;                                //* array of slots
+    size_t mask;                                //* length of the array minus one, the length is a power of two
+    _Alignas(LINE) atomic_size_t tail;          //* position of the next add, written by the producer
+    size_t headCache;                           //* producer's last look at head
+    _Alignas(LINE) atomic_size_t head;          //* position of the next remove, written by the consumer
+    size_t tailCache;                           //* consumer's last look at tail
+    char pad[LINE - 2 * sizeof(size_t)];
+};
+
+/*
+ * Function: roundUp
+ *
+ * Description: returns the smallest power of two that is at least the given length
+ *
+ * Big-O: O(log n)
+*/
+
+static size_t roundUp(int length)
+{
+    size_t n = 2;
+
+    while (n < length)
+    {
+        n *= 2;
+    }
+
+    return n;
+}
+
+/*
+ * Function: createRing
+ *
+ * Description: creates an empty multi-producer, multi-consumer queue holding up to length items, rounded up
+ *              to a power of two
+ *
+ * Big-O: O(n)
+*/
+
+RING *createRing(int length)
+{
+    size_t i, n = roundUp(length);
+    RING *rp = aligned_alloc(LINE, sizeof(RING));
+    assert(rp != NULL);
+    rp -> cells = aligned_alloc(LINE, ((sizeof(CELL) * n + LINE - 1) / LINE) * LINE);
+    assert(rp -> cells != NULL);
+    rp -> mask = n - 1;
+
+    for (i = 0; i < n; i++)
+    {
+        atomic_init(&rp -> cells[i].seq, i);
+    }
+
+    atomic_init(&rp -> tail, 0);
+    atomic_init(&rp -> head, 0);
+
+    return rp;
+}
+
+/*
+ * Function: destroyRing
+ *
+ * Description: destroys a given queue, but not the items still in it
+ *
+ * Big-O: O(1)
+*/
+
+void destroyRing(RING *rp)
+{
+    assert(rp != NULL);
+    free(rp -> cells);
+    free(rp);
+
+    return;
+}
+
+/*
+ * Function: addLastRing
+ *
+ * Description: adds an item at the rear of the queue. Returns 1 if it was added, or 0 if the queue is full.
+ *
+ * Big-O: O(1)
+*/
+
+int addLastRing(RING *rp, void *item)
+{
+    assert(rp != NULL && item != NULL);
+    CELL* cp;
+    intptr_t diff;
+    size_t pos = atomic_load_explicit(&rp -> tail, memory_order_relaxed);
+
+    while (1)
+    {
+        cp = &rp -> cells[pos & rp -> mask];
+        diff = (intptr_t) atomic_load_explicit(&cp -> seq, memory_order_acquire) - (intptr_t) pos;
+
+        //* the slot is free for this lap, so try to claim the position
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&rp -> tail, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        //* the slot still holds an item from the last lap
+        else if (diff < 0)
+        {
+            return 0;
+        }
+        //* another producer took the position first
+        else
+        {
+            pos = atomic_load_explicit(&rp -> tail, memory_order_relaxed);
+        }
+    }
+
+    cp -> data = item;
+    atomic_store_explicit(&cp -> seq, pos + 1, memory_order_release);
+
+    return 1;
+}
+
+/*
+ * Function: removeFirstRing
+ *
+ * Description: removes the item at the front of the queue. Returns NULL if the queue is empty.
+ *
+ * Big-O: O(1)
+*/
+
+void *removeFirstRing(RING *rp)
+{
+    assert(rp != NULL);
+    CELL* cp;
+    intptr_t diff;
+    void* item;
+    size_t pos = atomic_load_explicit(&rp -> head, memory_order_relaxed);
+
+    while (1)
+    {
+        cp = &rp -> cells[pos & rp -> mask];
+        diff = (intptr_t) atomic_load_explicit(&cp -> seq, memory_order_acquire) - (intptr_t) (pos + 1);
+
+        //* the slot holds the item for this position, so try to claim it
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&rp -> head, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        //* nothing has been added at this position yet
+        else if (diff < 0)
+        {
+            return NULL;
+        }
+        //* another consumer took the position first
+        else
+        {
+            pos = atomic_load_explicit(&rp -> head, memory_order_relaxed);
+        }
+    }
+
+    item = cp -> data;
+    atomic_store_explicit(&cp -> seq, pos + rp -> mask + 1, memory_order_release);
+
+    return item;
+}
+
+/*
+ * Function: createSpsc
+ *
+ * Description: creates an empty single-producer, single-consumer queue holding up to length items, rounded
+ *              up to a power of two
+ *
+ * Big-O: O(1)
+*/
+
+SPSC *createSpsc(int length)
+{
+    size_t n = roundUp(length);
+    SPSC *qp = aligned_alloc(LINE, sizeof(SPSC));
+    assert(qp != NULL);
+    qp -> data = malloc(sizeof(void*) * n);
+    assert(qp -> data != NULL);
+    qp -> mask = n - 1;
+    atomic_init(&qp -> tail, 0);
+    atomic_init(&qp -> head, 0);
+    qp -> headCache = 0;
+    qp -> tailCache = 0;
+
+    return qp;
+}
+
+/*
+ * Function: destroySpsc
+ *
+ * Description: destroys a given queue, but not the items still in it
+ *
+ * Big-O: O(1)
+*/
+
+void destroySpsc(SPSC *qp)
+{
+    assert(qp != NULL);
+    free(qp -> data);
+    free(qp);
+
+    return;
+}
+
+/*
+ * Function: addLastSpsc
+ *
+ * Description: adds an item at the rear of the queue. Returns 1 if it was added, or 0 if the queue is full.
+ *              Only one thread may call this function on a given queue.
+ *
+ * Big-O: O(1)
+*/
+
+int addLastSpsc(SPSC *qp, void *item)
+{
+    assert(qp != NULL && item != NULL);
+    size_t tail = atomic_load_explicit(&qp -> tail, memory_order_relaxed);
+
+    if (tail - qp -> headCache > qp -> mask)
+    {
+        qp -> headCache = atomic_load_explicit(&qp -> head, memory_order_acquire);
+        if (tail - qp -> headCache > qp -> mask)
+        {
+            return 0;
+        }
+    }
+
+    qp -> data[tail & qp -> mask] = item;
+    atomic_store_explicit(&qp -> tail, tail + 1, memory_order_release);
+
+    return 1;
+}
+
+/*
+ * Function: removeFirstSpsc
+ *
+ * Description: removes the item at the front of the queue. Returns NULL if the queue is empty. Only one
+ *              thread may call this function on a given queue.
+ *
+ * Big-O: O(1)
+*/
+
+void *removeFirstSpsc(SPSC *qp)
+{
+    assert(qp != NULL);
+    void* item;
+    size_t head = atomic_load_explicit(&qp -> head, memory_order_relaxed);
+
+    if (head == qp -> tailCache)
+    {
+        qp -> tailCache = atomic_load_explicit(&qp -> tail, memory_order_acquire);
+        if (head == qp -> tailCache)
+        {
+            return NULL;
+        }
+    }
+
+    item = qp -> data[head & qp -> mask];
+    atomic_store_explicit(&qp -> head, head + 1, memory_order_release);
+
+    return item;
+}
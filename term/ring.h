@@ -0,0 +1,37 @@
+/*
+ * File:	ring.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for bounded queues of generic pointer types
+ *		that can be shared between threads without locks.  A RING
+ *		may have any number of producers and consumers, while a
+ *		SPSC allows only one thread to add and one thread to
+ *		remove.  Items are added at the rear and removed from the
+ *		front as in a list; adding to a full queue returns zero and
+ *		removing from an empty queue returns NULL.
+ */
+
+# ifndef RING_H
+# define RING_H
+
+typedef struct ring RING;
+
+typedef struct spsc SPSC;
+
+extern RING *createRing(int length);
+
+extern void destroyRing(RING *rp);
+
+extern int addLastRing(RING *rp, void *item);
+
+extern void *removeFirstRing(RING *rp);
+
+extern SPSC *createSpsc(int length);
+
+extern void destroySpsc(SPSC *qp);
+
+extern int addLastSpsc(SPSC *qp, void *item);
+
+extern void *removeFirstSpsc(SPSC *qp);
+
+# endif /* RING_H */
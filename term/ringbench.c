@@ -0,0 +1,249 @@
+/*
+ * File Name: ringbench.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: Measures how fast items can be handed between threads. A number of producer threads add items
+ *              to a shared queue while consumer threads remove them, until every item has been moved once.
+ *              The queue is either the lock-free RING, the SPSC ring (one producer and one consumer only), or
+ *              a LIST guarded by a mutex. A thread that finds the queue full or empty yields and tries again.
+ *              The sum of all items removed is checked against the sum added, and the throughput is printed
+ *              in millions of items per second. It contains produce, consume, and main.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "ring.h"
+#include "list.h"
+
+#define MAX_THREADS 64      //* maximum number of producers or consumers
+#define RING_LENGTH 1024    //* slots in either ring
+
+enum { MPMC, SPSC_MODE, LOCKED };
+
+typedef struct worker
+{
+    int mode;               //* which queue is being measured
+    long first;             //* first item this producer adds
+    long count;             //* number of items to add or remove
+    unsigned long sum;      //* sum of the items this consumer removed
+}WORKER;
+
+static RING* ring;
+static SPSC* spsc;
+static LIST* list;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Function: produce
+ *
+ * Description: adds this producer's share of the items to the queue, items are never NULL
+ *
+ * Big-O: O(n)
+*/
+
+static void *produce(void *arg)
+{
+    WORKER* wp = arg;
+    long i;
+    void* item;
+
+    for (i = 0; i < wp -> count; i++)
+    {
+        item = (void*) (uintptr_t) (wp -> first + i + 1);
+
+        if (wp -> mode == MPMC)
+        {
+            while (!addLastRing(ring, item))
+            {
+                sched_yield();
+            }
+        }
+        else if (wp -> mode == SPSC_MODE)
+        {
+            while (!addLastSpsc(spsc, item))
+            {
+                sched_yield();
+            }
+        }
+        else
+        {
+            pthread_mutex_lock(&lock);
+            addLast(list, item);
+            pthread_mutex_unlock(&lock);
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Function: consume
+ *
+ * Description: removes this consumer's share of the items from the queue and adds them up
+ *
+ * Big-O: O(n)
+*/
+
+static void *consume(void *arg)
+{
+    WORKER* wp = arg;
+    long i;
+    void* item;
+
+    for (i = 0; i < wp -> count; i++)
+    {
+        while (1)
+        {
+            if (wp -> mode == MPMC)
+            {
+                item = removeFirstRing(ring);
+            }
+            else if (wp -> mode == SPSC_MODE)
+            {
+                item = removeFirstSpsc(spsc);
+            }
+            else
+            {
+                pthread_mutex_lock(&lock);
+                item = numItems(list) > 0 ? removeFirst(list) : NULL;
+                pthread_mutex_unlock(&lock);
+            }
+
+            if (item != NULL)
+            {
+                break;
+            }
+
+            sched_yield();
+        }
+
+        wp -> sum += (uintptr_t) item;
+    }
+
+    return NULL;
+}
+
+/*
+ * Function: main
+ *
+ * Description: driver function for the benchmark, usage: ringbench [-p producers] [-c consumers]
+ *              [-n items] mpmc|spsc|list
+ *
+ * Big-O: O(n)
+*/
+
+int main(int argc, char *argv[])
+{
+    int i, c, mode, producers = 1, consumers = 1;
+    long items = 10000000;
+    unsigned long sum = 0;
+    double seconds;
+    struct timespec start, stop;
+    pthread_t threads[2 * MAX_THREADS];
+    WORKER workers[2 * MAX_THREADS];
+
+    while ((c = getopt(argc, argv, "p:c:n:")) != -1)
+    {
+        if (c == 'p')
+        {
+            producers = atoi(optarg);
+        }
+        else if (c == 'c')
+        {
+            consumers = atoi(optarg);
+        }
+        else if (c == 'n')
+        {
+            items = atol(optarg);
+        }
+        else
+        {
+            argc = 0;
+        }
+    }
+
+    mode = -1;
+    if (optind == argc - 1)
+    {
+        mode = !strcmp(argv[optind], "mpmc") ? MPMC : !strcmp(argv[optind], "spsc") ? SPSC_MODE :
+               !strcmp(argv[optind], "list") ? LOCKED : -1;
+    }
+
+    if (mode == -1 || producers < 1 || producers > MAX_THREADS || consumers < 1 || consumers > MAX_THREADS ||
+        items < 1 || (mode == SPSC_MODE && (producers != 1 || consumers != 1)))
+    {
+        fprintf(stderr, "usage: ringbench [-p producers] [-c consumers] [-n items] mpmc|spsc|list\n");
+        fprintf(stderr, "       spsc needs exactly one producer and one consumer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ring = createRing(RING_LENGTH);
+    spsc = createSpsc(RING_LENGTH);
+    list = createList();
+
+    //* split the items as evenly as possible between the producers and between the consumers
+    for (i = 0; i < producers; i++)
+    {
+        workers[i].mode = mode;
+        workers[i].first = items * i / producers;
+        workers[i].count = items * (i + 1) / producers - workers[i].first;
+        workers[i].sum = 0;
+    }
+
+    for (i = 0; i < consumers; i++)
+    {
+        workers[producers + i].mode = mode;
+        workers[producers + i].first = 0;
+        workers[producers + i].count = items * (i + 1) / consumers - items * i / consumers;
+        workers[producers + i].sum = 0;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (i = 0; i < producers + consumers; i++)
+    {
+        if (pthread_create(&threads[i], NULL, i < producers ? produce : consume, &workers[i]) != 0)
+        {
+            fprintf(stderr, "cannot create thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (i = 0; i < producers + consumers; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    seconds = (stop.tv_sec - start.tv_sec) + (stop.tv_nsec - start.tv_nsec) / 1e9;
+
+    for (i = 0; i < consumers; i++)
+    {
+        sum += workers[producers + i].sum;
+    }
+
+    if (sum != (unsigned long) items * (items + 1) / 2)
+    {
+        fprintf(stderr, "items were lost or duplicated\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("%s %dp/%dc: %ld items in %.3f s, %.2f Mops/s\n", argv[optind], producers, consumers, items,
+           seconds, items / seconds / 1e6);
+
+    destroyList(list);
+    destroySpsc(spsc);
+    destroyRing(ring);
+
+    exit(EXIT_SUCCESS);
+}
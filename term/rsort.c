@@ -0,0 +1,726 @@
+/*
+ * File Name: rsort.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines a least significant digit radix sort for arrays of unsigned integers.
+ *              Each 32-bit key is split into four 8-bit digits, so each pass is a counting sort into 256 buckets
+ *              whose counts fit in the first level cache. The counts for all four digits are gathered in one
+ *              read of the keys before any pass runs. A pass where every key has the same digit would not move
+ *              anything and is skipped, so small keys need fewer passes. The passes move the keys back and forth
+ *              between the array and a scratch array of the same length. Short arrays are insertion sorted instead.
+ *              The parallel version splits the array into one slice per thread. For each pass, every thread
+ *              counts the digits in its slice, a prefix sum over all the counts gives every thread its own
+ *              range of slots in each bucket, and the threads then scatter their slices at the same time. Each
+ *              thread collects keys for a bucket in a small buffer the size of a cache line and copies it out
+ *              when it reaches the end of a line of the output. The first copy for a bucket fills only up to the
+ *              first line boundary, so every later copy writes exactly one whole, aligned line. The threads take
+ *              keys from their slices in order and fill their ranges in order, so the result is the same as the
+ *              serial sort. Signed integers and floating point values are sorted by changing their bits so that
+ *              comparing them as unsigned integers gives the right order, sorting, and changing them back. Keys
+ *              of 64 bits take eight passes, and whether unsigned, signed, or doubles can carry an item such as
+ *              a pointer or index along with them. These functions include insertionSort, radixSort, countSlice,
+ *              scatterSlice, runSlices, setSlices, parallelRadixSort, insertionSortItems, radixSortItems,
+ *              radixSort64, radixSortInt32, radixSortItemsInt64, radixSortInt64, radixSortFloat,
+ *              radixSortItemsDouble, and radixSortDouble.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "rsort.h"
+
+#define DIGIT_BITS 8                    //* bits in one digit
+#define BUCKETS (1 << DIGIT_BITS)       //* buckets per pass
+#define PASSES (32 / DIGIT_BITS)        //* digits in a key
+#define PASSES64 (64 / DIGIT_BITS)      //* digits in a 64-bit key
+#define SIGN32 ((uint32_t) 1 << 31)     //* sign bit of a 32-bit value
+#define SIGN64 ((uint64_t) 1 << 63)     //* sign bit of a 64-bit value
+#define MIN_RADIX 64                    //* arrays shorter than this are insertion sorted
+#define MIN_PARALLEL 65536              //* arrays shorter than this are sorted by one thread
+#define LINE_KEYS 16                    //* keys in one cache line, the size of a scatter buffer
+
+typedef struct slice
+{
+    uint32_t *src, *dst;                //* arrays the current pass reads and writes
+    size_t lo, hi;                      //* range of the source this thread handles
+    int pass;                           //* digit of the current pass, or -1 to count every digit
+    int scatter;                        //* whether to scatter the slice rather than count it
+    size_t counts[PASSES][BUCKETS];     //* digits in the slice, then the next slot of each bucket
+    uint32_t buffer[BUCKETS][LINE_KEYS];//* keys waiting to be written, per bucket
+    int fill[BUCKETS];                  //* keys in each buffer
+    int start[BUCKETS];                 //* slot in each buffer of the first key not yet written
+}SLICE;
+
+/*
+ * Function: insertionSort
+ *
+ * Description: sorts a short array of keys in place
+ *
+ * Big-O: O(n^2)
+*/
+
+static void insertionSort(uint32_t *keys, size_t n)
+{
+    size_t i, j;
+    uint32_t key;
+
+    for (i = 1; i < n; i++)
+    {
+        key = keys[i];
+        for (j = i; j > 0 && keys[j - 1] > key; j--)
+        {
+            keys[j] = keys[j - 1];
+        }
+        keys[j] = key;
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSort
+ *
+ * Description: sorts an array of keys in place into increasing order
+ *
+ * Big-O: O(n)
+*/
+
+void radixSort(uint32_t *keys, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    size_t i, sum, counts[PASSES][BUCKETS];
+    uint32_t *src = keys, *dst, *temp, key;
+    int pass, shift, b;
+
+    if (n < MIN_RADIX)
+    {
+        insertionSort(keys, n);
+        return;
+    }
+
+    temp = malloc(sizeof(uint32_t) * n);
+    assert(temp != NULL);
+    dst = temp;
+
+    //* count every digit of every key in one read of the array
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++)
+    {
+        key = keys[i];
+        counts[0][key & (BUCKETS - 1)]++;
+        counts[1][(key >> DIGIT_BITS) & (BUCKETS - 1)]++;
+        counts[2][(key >> 2 * DIGIT_BITS) & (BUCKETS - 1)]++;
+        counts[3][key >> 3 * DIGIT_BITS]++;
+    }
+
+    for (pass = 0; pass < PASSES; pass++)
+    {
+        shift = pass * DIGIT_BITS;
+
+        //* every key has the same digit, so the pass would leave the order alone
+        if (counts[pass][(src[0] >> shift) & (BUCKETS - 1)] == n)
+        {
+            continue;
+        }
+
+        //* turn the counts into the first slot of each bucket
+        for (b = 0, sum = 0; b < BUCKETS; b++)
+        {
+            size_t count = counts[pass][b];
+            counts[pass][b] = sum;
+            sum += count;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            key = src[i];
+            dst[counts[pass][(key >> shift) & (BUCKETS - 1)]++] = key;
+        }
+
+        uint32_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    //* an odd number of passes leaves the sorted keys in the scratch array
+    if (src != keys)
+    {
+        memcpy(keys, src, sizeof(uint32_t) * n);
+    }
+
+    free(temp);
+
+    return;
+}
+
+/*
+ * Function: countSlice
+ *
+ * Description: counts the digits of the current pass in a thread's slice, or every digit on the first pass
+ *
+ * Big-O: O(n)
+*/
+
+static void countSlice(SLICE *sp)
+{
+    size_t i;
+    uint32_t key;
+    int shift = sp -> pass * DIGIT_BITS;
+
+    if (sp -> pass < 0)
+    {
+        memset(sp -> counts, 0, sizeof(sp -> counts));
+        for (i = sp -> lo; i < sp -> hi; i++)
+        {
+            key = sp -> src[i];
+            sp -> counts[0][key & (BUCKETS - 1)]++;
+            sp -> counts[1][(key >> DIGIT_BITS) & (BUCKETS - 1)]++;
+            sp -> counts[2][(key >> 2 * DIGIT_BITS) & (BUCKETS - 1)]++;
+            sp -> counts[3][key >> 3 * DIGIT_BITS]++;
+        }
+    }
+    else
+    {
+        memset(sp -> counts[sp -> pass], 0, sizeof(sp -> counts[0]));
+        for (i = sp -> lo; i < sp -> hi; i++)
+        {
+            sp -> counts[sp -> pass][(sp -> src[i] >> shift) & (BUCKETS - 1)]++;
+        }
+    }
+
+    return;
+}
+
+/*
+ * Function: scatterSlice
+ *
+ * Description: moves the keys of a thread's slice to that thread's slots in each bucket, a cache line at a
+ *              time. Each buffer mirrors a line of the output, so a key sits in the slot of the buffer that
+ *              matches its place in the line, and the buffer is written once its last slot is filled.
+ *
+ * Big-O: O(n)
+*/
+
+static void scatterSlice(SLICE *sp)
+{
+    size_t i, *next = sp -> counts[sp -> pass];
+    uint32_t key;
+    int b, shift = sp -> pass * DIGIT_BITS;
+
+    //* start each buffer at the place in its line of the first slot the bucket will write
+    for (b = 0; b < BUCKETS; b++)
+    {
+        sp -> start[b] = sp -> fill[b] = (uintptr_t) (sp -> dst + next[b]) / sizeof(uint32_t) % LINE_KEYS;
+    }
+
+    for (i = sp -> lo; i < sp -> hi; i++)
+    {
+        key = sp -> src[i];
+        b = (key >> shift) & (BUCKETS - 1);
+        sp -> buffer[b][sp -> fill[b]++] = key;
+
+        if (sp -> fill[b] == LINE_KEYS)
+        {
+            memcpy(sp -> dst + next[b], sp -> buffer[b] + sp -> start[b],
+                   sizeof(uint32_t) * (LINE_KEYS - sp -> start[b]));
+            next[b] += LINE_KEYS - sp -> start[b];
+            sp -> start[b] = sp -> fill[b] = 0;
+        }
+    }
+
+    //* write out whatever is left in the buffers
+    for (b = 0; b < BUCKETS; b++)
+    {
+        memcpy(sp -> dst + next[b], sp -> buffer[b] + sp -> start[b],
+               sizeof(uint32_t) * (sp -> fill[b] - sp -> start[b]));
+        next[b] += sp -> fill[b] - sp -> start[b];
+    }
+
+    return;
+}
+
+/*
+ * Function: runSlices
+ *
+ * Description: counts or scatters each slice in a range, as set in the slices, called by parallelFor
+ *
+ * Big-O: O(n)
+*/
+
+static void runSlices(void *arg, int lo, int hi)
+{
+    SLICE *slices = arg;
+    int i;
+
+    for (i = lo; i < hi; i++)
+    {
+        if (slices[i].scatter)
+        {
+            scatterSlice(&slices[i]);
+        }
+        else
+        {
+            countSlice(&slices[i]);
+        }
+    }
+
+    return;
+}
+
+/*
+ * Function: setSlices
+ *
+ * Description: sets the arrays, pass, and phase for every slice before running them
+ *
+ * Big-O: O(p)
+*/
+
+static void setSlices(SLICE *slices, int nslices, uint32_t *src, uint32_t *dst, int pass, int scatter)
+{
+    int s;
+
+    for (s = 0; s < nslices; s++)
+    {
+        slices[s].src = src;
+        slices[s].dst = dst;
+        slices[s].pass = pass;
+        slices[s].scatter = scatter;
+    }
+
+    return;
+}
+
+/*
+ * Function: parallelRadixSort
+ *
+ * Description: sorts an array of keys in place into increasing order using the workers of a pool and the
+ *              calling thread, giving the same result as radixSort
+ *
+ * Big-O: O(n / p)
+*/
+
+void parallelRadixSort(POOL *pp, uint32_t *keys, size_t n)
+{
+    assert(pp != NULL && (keys != NULL || n == 0));
+    int nslices = numWorkers(pp) + 1, pass, s, b, moved = 0;
+    size_t sum, total;
+    uint32_t *src = keys, *dst, *temp, *swap;
+    SLICE *slices;
+    int skip[PASSES];
+
+    if (n < MIN_PARALLEL)
+    {
+        radixSort(keys, n);
+        return;
+    }
+
+    temp = malloc(sizeof(uint32_t) * n);
+    slices = malloc(sizeof(SLICE) * nslices);
+    assert(temp != NULL && slices != NULL);
+    dst = temp;
+
+    for (s = 0; s < nslices; s++)
+    {
+        slices[s].lo = n * s / nslices;
+        slices[s].hi = n * (s + 1) / nslices;
+    }
+
+    //* count every digit once, since how many keys have each digit does not change as the keys move
+    setSlices(slices, nslices, src, dst, -1, 0);
+    parallelFor(pp, 0, nslices, 1, runSlices, slices);
+
+    for (pass = 0; pass < PASSES; pass++)
+    {
+        b = (keys[0] >> pass * DIGIT_BITS) & (BUCKETS - 1);
+        for (s = 0, total = 0; s < nslices; s++)
+        {
+            total += slices[s].counts[pass][b];
+        }
+        skip[pass] = total == n;
+    }
+
+    for (pass = 0; pass < PASSES; pass++)
+    {
+        if (skip[pass])
+        {
+            continue;
+        }
+
+        //* once keys have moved, each slice holds different keys and must be counted again
+        if (moved)
+        {
+            setSlices(slices, nslices, src, dst, pass, 0);
+            parallelFor(pp, 0, nslices, 1, runSlices, slices);
+        }
+
+        //* bucket by bucket, give each slice the slots after those of the slices before it
+        for (b = 0, sum = 0; b < BUCKETS; b++)
+        {
+            for (s = 0; s < nslices; s++)
+            {
+                size_t count = slices[s].counts[pass][b];
+                slices[s].counts[pass][b] = sum;
+                sum += count;
+            }
+        }
+
+        setSlices(slices, nslices, src, dst, pass, 1);
+        parallelFor(pp, 0, nslices, 1, runSlices, slices);
+        moved = 1;
+
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != keys)
+    {
+        memcpy(keys, src, sizeof(uint32_t) * n);
+    }
+
+    free(slices);
+    free(temp);
+
+    return;
+}
+
+/*
+ * Function: insertionSortItems
+ *
+ * Description: sorts a short array of 64-bit keys in place, moving the items along with their keys if there
+ *              are any, and keeping equal keys in order
+ *
+ * Big-O: O(n^2)
+*/
+
+static void insertionSortItems(uint64_t *keys, void **items, size_t n)
+{
+    size_t i, j;
+    uint64_t key;
+    void *item = NULL;
+
+    for (i = 1; i < n; i++)
+    {
+        key = keys[i];
+        if (items != NULL)
+        {
+            item = items[i];
+        }
+
+        for (j = i; j > 0 && keys[j - 1] > key; j--)
+        {
+            keys[j] = keys[j - 1];
+            if (items != NULL)
+            {
+                items[j] = items[j - 1];
+            }
+        }
+
+        keys[j] = key;
+        if (items != NULL)
+        {
+            items[j] = item;
+        }
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSortItems
+ *
+ * Description: sorts an array of 64-bit keys in place into increasing order. If items is not NULL, the item
+ *              at each index moves with the key at that index, so records can be sorted by passing their keys
+ *              and pointers or indices to them. Records with equal keys stay in the order they were in.
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortItems(uint64_t *keys, void **items, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    size_t i, sum, slot, counts[PASSES64][BUCKETS];
+    uint64_t *src = keys, *dst, *temp, *swap, key;
+    void **isrc = items, **idst = NULL, **itemp = NULL, **iswap;
+    int pass, shift, b;
+
+    if (n < MIN_RADIX)
+    {
+        insertionSortItems(keys, items, n);
+        return;
+    }
+
+    temp = malloc(sizeof(uint64_t) * n);
+    assert(temp != NULL);
+    dst = temp;
+
+    if (items != NULL)
+    {
+        itemp = malloc(sizeof(void*) * n);
+        assert(itemp != NULL);
+        idst = itemp;
+    }
+
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++)
+    {
+        key = keys[i];
+        for (pass = 0; pass < PASSES64; pass++)
+        {
+            counts[pass][(key >> pass * DIGIT_BITS) & (BUCKETS - 1)]++;
+        }
+    }
+
+    for (pass = 0; pass < PASSES64; pass++)
+    {
+        shift = pass * DIGIT_BITS;
+
+        if (counts[pass][(src[0] >> shift) & (BUCKETS - 1)] == n)
+        {
+            continue;
+        }
+
+        for (b = 0, sum = 0; b < BUCKETS; b++)
+        {
+            size_t count = counts[pass][b];
+            counts[pass][b] = sum;
+            sum += count;
+        }
+
+        if (items == NULL)
+        {
+            for (i = 0; i < n; i++)
+            {
+                key = src[i];
+                dst[counts[pass][(key >> shift) & (BUCKETS - 1)]++] = key;
+            }
+        }
+        else
+        {
+            for (i = 0; i < n; i++)
+            {
+                key = src[i];
+                slot = counts[pass][(key >> shift) & (BUCKETS - 1)]++;
+                dst[slot] = key;
+                idst[slot] = isrc[i];
+            }
+
+            iswap = isrc;
+            isrc = idst;
+            idst = iswap;
+        }
+
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != keys)
+    {
+        memcpy(keys, src, sizeof(uint64_t) * n);
+        if (items != NULL)
+        {
+            memcpy(items, isrc, sizeof(void*) * n);
+        }
+    }
+
+    free(itemp);
+    free(temp);
+
+    return;
+}
+
+/*
+ * Function: radixSort64
+ *
+ * Description: sorts an array of 64-bit keys in place into increasing order
+ *
+ * Big-O: O(n)
+*/
+
+void radixSort64(uint64_t *keys, size_t n)
+{
+    radixSortItems(keys, NULL, n);
+
+    return;
+}
+
+/*
+ * Function: radixSortInt32
+ *
+ * Description: sorts an array of signed 32-bit integers in place, using the pool if it is not NULL. Flipping
+ *              the sign bit makes the negative values come first when the bits are compared as unsigned, and
+ *              flipping it again afterward restores the values.
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortInt32(POOL *pp, int32_t *keys, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    uint32_t *bits = (uint32_t *) keys;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        bits[i] ^= SIGN32;
+    }
+
+    if (pp != NULL)
+    {
+        parallelRadixSort(pp, bits, n);
+    }
+    else
+    {
+        radixSort(bits, n);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        bits[i] ^= SIGN32;
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSortItemsInt64
+ *
+ * Description: sorts an array of signed 64-bit integers in place by flipping the sign bit, as radixSortInt32
+ *              does. If items is not NULL, the items move with the keys as in radixSortItems.
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortItemsInt64(int64_t *keys, void **items, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    uint64_t *bits = (uint64_t *) keys;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        bits[i] ^= SIGN64;
+    }
+
+    radixSortItems(bits, items, n);
+
+    for (i = 0; i < n; i++)
+    {
+        bits[i] ^= SIGN64;
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSortInt64
+ *
+ * Description: sorts an array of signed 64-bit integers in place
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortInt64(int64_t *keys, size_t n)
+{
+    radixSortItemsInt64(keys, NULL, n);
+
+    return;
+}
+
+/*
+ * Function: radixSortFloat
+ *
+ * Description: sorts an array of floats in place, using the pool if it is not NULL. Setting the sign bit of
+ *              positive values and flipping every bit of negative ones makes the bits compare as unsigned in
+ *              the same order as the values. Negative NaNs sort first and positive NaNs last.
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortFloat(POOL *pp, float *keys, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    uint32_t bits;
+    size_t i;
+
+    //* each value is copied to an integer and back rather than read through an integer pointer, which the
+    //* compiler may assume never points to a float, and the copy leaves the array holding integers to sort
+    for (i = 0; i < n; i++)
+    {
+        memcpy(&bits, &keys[i], sizeof(bits));
+        bits = (bits & SIGN32) ? ~bits : bits | SIGN32;
+        memcpy(&keys[i], &bits, sizeof(bits));
+    }
+
+    if (pp != NULL)
+    {
+        parallelRadixSort(pp, (uint32_t *) keys, n);
+    }
+    else
+    {
+        radixSort((uint32_t *) keys, n);
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        memcpy(&bits, &keys[i], sizeof(bits));
+        bits = (bits & SIGN32) ? bits ^ SIGN32 : ~bits;
+        memcpy(&keys[i], &bits, sizeof(bits));
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSortItemsDouble
+ *
+ * Description: sorts an array of doubles in place using the same transform as radixSortFloat. If items is not
+ *              NULL, the items move with the keys as in radixSortItems.
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortItemsDouble(double *keys, void **items, size_t n)
+{
+    assert(keys != NULL || n == 0);
+    uint64_t bits;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        memcpy(&bits, &keys[i], sizeof(bits));
+        bits = (bits & SIGN64) ? ~bits : bits | SIGN64;
+        memcpy(&keys[i], &bits, sizeof(bits));
+    }
+
+    radixSortItems((uint64_t *) keys, items, n);
+
+    for (i = 0; i < n; i++)
+    {
+        memcpy(&bits, &keys[i], sizeof(bits));
+        bits = (bits & SIGN64) ? bits ^ SIGN64 : ~bits;
+        memcpy(&keys[i], &bits, sizeof(bits));
+    }
+
+    return;
+}
+
+/*
+ * Function: radixSortDouble
+ *
+ * Description: sorts an array of doubles in place
+ *
+ * Big-O: O(n)
+*/
+
+void radixSortDouble(double *keys, size_t n)
+{
+    radixSortItemsDouble(keys, NULL, n);
+
+    return;
+}
@@ -0,0 +1,40 @@
+/*
+ * File:	rsort.h
+ *
+ * Description:	This file contains the public function declarations
+ *		for sorting arrays by least significant digit radix sort,
+ *		one byte at a time.  Unsigned, signed, and floating point
+ *		values of 32 and 64 bits can be sorted, and 64-bit keys
+ *		of any of these kinds can carry an item along with them.
+ *		The 32-bit sorts can use the workers of a pool, which may
+ *		be NULL.
+ */
+
+# ifndef RSORT_H
+# define RSORT_H
+
+# include <stddef.h>
+# include <stdint.h>
+# include "task.h"
+
+extern void radixSort(uint32_t *keys, size_t n);
+
+extern void parallelRadixSort(POOL *pp, uint32_t *keys, size_t n);
+
+extern void radixSort64(uint64_t *keys, size_t n);
+
+extern void radixSortItems(uint64_t *keys, void **items, size_t n);
+
+extern void radixSortInt32(POOL *pp, int32_t *keys, size_t n);
+
+extern void radixSortItemsInt64(int64_t *keys, void **items, size_t n);
+
+extern void radixSortInt64(int64_t *keys, size_t n);
+
+extern void radixSortFloat(POOL *pp, float *keys, size_t n);
+
+extern void radixSortItemsDouble(double *keys, void **items, size_t n);
+
+extern void radixSortDouble(double *keys, size_t n);
+
+# endif /* RSORT_H */
@@ -0,0 +1,484 @@
+/*
+ * File Name: task.c
+ *
+ * Author: Jake Esperson
+ *
+ * Date: 10-19-2026
+ *
+ * Description: This file defines a fixed pool of worker threads that run tasks. Every worker owns a DEQUE: it
+ *              adds the tasks it submits at the rear and runs them from the rear, while idle workers steal from
+ *              the front of other deques. Tasks submitted from threads outside the pool go into a shared RING,
+ *              which workers check before stealing. A worker that finds nothing to do yields a few times and then
+ *              sleeps until more tasks are submitted. Threads that wait for tasks run other tasks while they
+ *              wait, so a task can itself call parallelFor without tying up a worker. These functions include
+ *              findTask, runTask, worker, wake, push, createPool, destroyPool, numWorkers, submitTask, help,
+ *              waitTasks, and parallelFor.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sched.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "task.h"
+#include "deque.h"
+#include "ring.h"
+
+#define MAX_WORKERS 256     //* maximum number of worker threads
+#define INJECT_LENGTH 4096  //* slots in the queue for tasks from outside the pool
+#define SPINS 64            //* times an idle worker yields before it sleeps
+
+typedef struct task
+{
+    void (*fn)(void*);                  //* function to run, or NULL for a range
+    void (*range)(void*, int, int);     //* function to run over lo to hi
+    void* arg;                          //* argument to either function
+    int lo, hi;                         //* range of indices
+    atomic_int* pending;                //* count of unfinished tasks this one belongs to
+    int owned;                          //* whether the task is freed after it runs
+}TASK;
+
+struct pool
+{
+    int count;                  //* number of workers
+    int pinned;                 //* whether workers are pinned to processors
+    pthread_t* threads;         //* worker threads
+    DEQUE** deques;             //* deque owned by each worker
+    RING* inject;               //* tasks submitted from outside the pool
+    atomic_int pending;         //* tasks from submitTask that have not finished
+    atomic_int stop;            //* set when the pool is destroyed
+    atomic_uint epoch;          //* bumped whenever a task is submitted
+    atomic_int sleepers;        //* workers waiting on the condition
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+};
+
+typedef struct start
+{
+    POOL* pp;
+    int id;
+}START;
+
+static _Thread_local POOL* current;     //* pool the calling thread works for, if any
+static _Thread_local int self = -1;     //* index of the calling worker in that pool
+static _Thread_local unsigned seed;     //* random state for choosing victims
+
+/*
+ * Function: findTask
+ *
+ * Description: returns a task to run, looking in the caller's own deque, then the shared queue, and then the
+ *              other workers' deques, or NULL if none was found
+ *
+ * Big-O: O(w), w is the number of workers
+*/
+
+static TASK *findTask(POOL *pp)
+{
+    int i, id, start;
+    TASK* tp;
+
+    id = current == pp ? self : -1;
+    if (id >= 0 && (tp = removeLastDeque(pp -> deques[id])) != NULL)
+    {
+        return tp;
+    }
+
+    if ((tp = removeFirstRing(pp -> inject)) != NULL)
+    {
+        return tp;
+    }
+
+    //* start at a different victim each time so thieves spread out
+    start = rand_r(&seed) % pp -> count;
+    for (i = 0; i < pp -> count; i++)
+    {
+        int victim = (start + i) % pp -> count;
+        if (victim != id && (tp = stealFirstDeque(pp -> deques[victim])) != NULL)
+        {
+            return tp;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Function: runTask
+ *
+ * Description: runs a task and marks it finished
+ *
+ * Big-O: O(1) plus the task
+*/
+
+static void runTask(TASK *tp)
+{
+    atomic_int* pending = tp -> pending;
+
+    if (tp -> fn != NULL)
+    {
+        (*tp -> fn)(tp -> arg);
+    }
+    else
+    {
+        (*tp -> range)(tp -> arg, tp -> lo, tp -> hi);
+    }
+
+    if (tp -> owned)
+    {
+        free(tp);
+    }
+
+    atomic_fetch_sub_explicit(pending, 1, memory_order_release);
+
+    return;
+}
+
+/*
+ * Function: worker
+ *
+ * Description: runs tasks until the pool is destroyed, sleeping when there is nothing to do
+ *
+ * Big-O: O(1) plus the tasks
+*/
+
+static void *worker(void *arg)
+{
+    START* sp = arg;
+    POOL* pp = sp -> pp;
+    TASK* tp;
+    unsigned epoch;
+    int spins = 0;
+
+    current = pp;
+    self = sp -> id;
+    seed = sp -> id + 1;
+    free(sp);
+
+    while (!atomic_load(&pp -> stop))
+    {
+        epoch = atomic_load(&pp -> epoch);
+
+        if ((tp = findTask(pp)) != NULL)
+        {
+            runTask(tp);
+            spins = 0;
+        }
+        else if (spins < SPINS)
+        {
+            sched_yield();
+            spins++;
+        }
+        else
+        {
+            //* sleep only if nothing was submitted since the search began
+            pthread_mutex_lock(&pp -> lock);
+            atomic_fetch_add(&pp -> sleepers, 1);
+            while (atomic_load(&pp -> epoch) == epoch && !atomic_load(&pp -> stop))
+            {
+                pthread_cond_wait(&pp -> cond, &pp -> lock);
+            }
+            atomic_fetch_sub(&pp -> sleepers, 1);
+            pthread_mutex_unlock(&pp -> lock);
+            spins = 0;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Function: wake
+ *
+ * Description: tells sleeping workers that a task has been submitted
+ *
+ * Big-O: O(1)
+*/
+
+static void wake(POOL *pp)
+{
+    atomic_fetch_add(&pp -> epoch, 1);
+
+    if (atomic_load(&pp -> sleepers) > 0)
+    {
+        pthread_mutex_lock(&pp -> lock);
+        pthread_cond_broadcast(&pp -> cond);
+        pthread_mutex_unlock(&pp -> lock);
+    }
+
+    return;
+}
+
+/*
+ * Function: push
+ *
+ * Description: adds a task to the caller's deque if it is a worker, or to the shared queue otherwise. If the
+ *              shared queue is full, the caller runs the task itself.
+ *
+ * Big-O: O(1) amortized
+*/
+
+static void push(POOL *pp, TASK *tp)
+{
+    if (current == pp)
+    {
+        addLastDeque(pp -> deques[self], tp);
+    }
+    else if (!addLastRing(pp -> inject, tp))
+    {
+        runTask(tp);
+        return;
+    }
+
+    wake(pp);
+
+    return;
+}
+
+/*
+ * Function: createPool
+ *
+ * Description: creates a pool with the given number of workers, or one per processor if workers is zero. If
+ *              pinned is nonzero, worker i only runs on processor i modulo the number of processors.
+ *
+ * Big-O: O(w)
+*/
+
+POOL *createPool(int workers, int pinned)
+{
+    int i;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    START* sp;
+    POOL *pp = malloc(sizeof(POOL));
+    assert(pp != NULL);
+
+    if (cpus < 1)
+    {
+        cpus = 1;
+    }
+
+    if (workers <= 0)
+    {
+        workers = cpus;
+    }
+
+    assert(workers <= MAX_WORKERS);
+    pp -> count = workers;
+    pp -> pinned = pinned;
+    pp -> threads = malloc(sizeof(pthread_t) * workers);
+    pp -> deques = malloc(sizeof(DEQUE*) * workers);
+    assert(pp -> threads != NULL && pp -> deques != NULL);
+    pp -> inject = createRing(INJECT_LENGTH);
+    atomic_init(&pp -> pending, 0);
+    atomic_init(&pp -> stop, 0);
+    atomic_init(&pp -> epoch, 0);
+    atomic_init(&pp -> sleepers, 0);
+    pthread_mutex_init(&pp -> lock, NULL);
+    pthread_cond_init(&pp -> cond, NULL);
+
+    for (i = 0; i < workers; i++)
+    {
+        pp -> deques[i] = createDeque();
+    }
+
+    for (i = 0; i < workers; i++)
+    {
+        sp = malloc(sizeof(START));
+        assert(sp != NULL);
+        sp -> pp = pp;
+        sp -> id = i;
+
+        if (pthread_create(&pp -> threads[i], NULL, worker, sp) != 0)
+        {
+            fprintf(stderr, "cannot create thread\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (pinned)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(i % cpus, &set);
+            pthread_setaffinity_np(pp -> threads[i], sizeof(set), &set);
+        }
+    }
+
+    return pp;
+}
+
+/*
+ * Function: destroyPool
+ *
+ * Description: waits for every submitted task, then stops and frees the workers
+ *
+ * Big-O: O(w) plus the tasks
+*/
+
+void destroyPool(POOL *pp)
+{
+    int i;
+    assert(pp != NULL);
+
+    waitTasks(pp);
+    atomic_store(&pp -> stop, 1);
+
+    pthread_mutex_lock(&pp -> lock);
+    pthread_cond_broadcast(&pp -> cond);
+    pthread_mutex_unlock(&pp -> lock);
+
+    //* every worker must stop before any deque is freed, since any of them may be stealing from it
+    for (i = 0; i < pp -> count; i++)
+    {
+        pthread_join(pp -> threads[i], NULL);
+    }
+
+    for (i = 0; i < pp -> count; i++)
+    {
+        destroyDeque(pp -> deques[i]);
+    }
+
+    destroyRing(pp -> inject);
+    pthread_cond_destroy(&pp -> cond);
+    pthread_mutex_destroy(&pp -> lock);
+    free(pp -> deques);
+    free(pp -> threads);
+    free(pp);
+
+    return;
+}
+
+/*
+ * Function: numWorkers
+ *
+ * Description: returns the number of workers in the pool
+ *
+ * Big-O: O(1)
+*/
+
+int numWorkers(POOL *pp)
+{
+    assert(pp != NULL);
+    return pp -> count;
+}
+
+/*
+ * Function: submitTask
+ *
+ * Description: submits a task that calls fn with arg, to be waited for by waitTasks
+ *
+ * Big-O: O(1) amortized
+*/
+
+void submitTask(POOL *pp, void (*fn)(void *), void *arg)
+{
+    assert(pp != NULL && fn != NULL);
+    TASK *tp = malloc(sizeof(TASK));
+    assert(tp != NULL);
+    tp -> fn = fn;
+    tp -> range = NULL;
+    tp -> arg = arg;
+    tp -> pending = &pp -> pending;
+    tp -> owned = 1;
+
+    atomic_fetch_add(&pp -> pending, 1);
+    push(pp, tp);
+
+    return;
+}
+
+/*
+ * Function: help
+ *
+ * Description: runs other tasks until the given count of unfinished tasks reaches zero
+ *
+ * Big-O: O(1) plus the tasks
+*/
+
+static void help(POOL *pp, atomic_int *pending)
+{
+    TASK* tp;
+
+    while (atomic_load_explicit(pending, memory_order_acquire) > 0)
+    {
+        if ((tp = findTask(pp)) != NULL)
+        {
+            runTask(tp);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    return;
+}
+
+/*
+ * Function: waitTasks
+ *
+ * Description: waits until every task given to submitTask has finished, running tasks in the meantime. It
+ *              must not be called from inside a task.
+ *
+ * Big-O: O(1) plus the tasks
+*/
+
+void waitTasks(POOL *pp)
+{
+    assert(pp != NULL);
+    help(pp, &pp -> pending);
+
+    return;
+}
+
+/*
+ * Function: parallelFor
+ *
+ * Description: calls fn(arg, i, j) over consecutive pieces [i, j) of the range lo to hi, each at most chunk
+ *              indices long, and returns when all of them have finished. If chunk is zero, the range is split
+ *              into four pieces per worker. It may be called from inside a task.
+ *
+ * Big-O: O(n / chunk) plus the tasks
+*/
+
+void parallelFor(POOL *pp, int lo, int hi, int chunk, void (*fn)(void *, int, int), void *arg)
+{
+    assert(pp != NULL && fn != NULL);
+    int i, n;
+    atomic_int pending;
+    TASK* tasks;
+
+    if (hi <= lo)
+    {
+        return;
+    }
+
+    if (chunk <= 0)
+    {
+        chunk = (hi - lo + 4 * pp -> count - 1) / (4 * pp -> count);
+    }
+
+    n = (hi - lo + chunk - 1) / chunk;
+    tasks = malloc(sizeof(TASK) * n);
+    assert(tasks != NULL);
+    atomic_init(&pending, n);
+
+    //* push the pieces in reverse so the owner runs them from the front and thieves take the back
+    for (i = n - 1; i >= 0; i--)
+    {
+        tasks[i].fn = NULL;
+        tasks[i].range = fn;
+        tasks[i].arg = arg;
+        tasks[i].lo = lo + i * chunk;
+        tasks[i].hi = tasks[i].lo + chunk < hi ? tasks[i].lo + chunk : hi;
+        tasks[i].pending = &pending;
+        tasks[i].owned = 0;
+        push(pp, &tasks[i]);
+    }
+
+    help(pp, &pending);
+    free(tasks);
+
+    return;
+}
@@ -0,0 +1,32 @@
+/*
+ * File:	task.h
+ *
+ * Description:	This file contains the public function and type
+ *		declarations for a pool of worker threads that run tasks.
+ *		A task is a function and an argument.  Tasks submitted by
+ *		a worker go to that worker's own deque and idle workers
+ *		steal from one another, while tasks submitted from other
+ *		threads go through a shared queue.  A thread that waits
+ *		for tasks runs tasks itself until they are done.  The
+ *		workers may be pinned to processors.
+ */
+
+# ifndef TASK_H
+# define TASK_H
+
+typedef struct pool POOL;
+
+extern POOL *createPool(int workers, int pinned);
+
+extern void destroyPool(POOL *pp);
+
+extern int numWorkers(POOL *pp);
+
+extern void submitTask(POOL *pp, void (*fn)(void *), void *arg);
+
+extern void waitTasks(POOL *pp);
+
+extern void parallelFor(POOL *pp, int lo, int hi, int chunk,
+			void (*fn)(void *, int, int), void *arg);
+
+# endif /* TASK_H */